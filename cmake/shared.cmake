@@ -82,6 +82,17 @@ endfunction()
 
 
 
+# Unit tests live in <component>/src/test, one source file each, and
+# are run by ctest
+function (dyninst_test target source)
+  if(BUILD_TESTS)
+    SET_SOURCE_FILES_PROPERTIES(${source} PROPERTIES LANGUAGE CXX)
+    add_executable (${target} ${source})
+    target_link_libraries (${target} ${ARGN})
+    add_test (${target} ${target})
+  endif()
+endfunction()
+
 #Change to switch between libiberty/libstdc++ demangler
 #set(USE_GNU_DEMANGLER 1)
 
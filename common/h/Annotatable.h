@@ -506,115 +506,30 @@ class COMMON_EXPORT AnnotatableSparse
 
 	  ~AnnotatableSparse()
 	  {
-		  //  We need to remove annotations from the static map when objects
+		  //  We need to remove annotations from the static store when objects
 		  //  are destroyed:  (1)  memory may be reclaimed and reused at the same
-		  //  place, and (2) regardless of 1, the map can possibly explode to 
-		  //  unmanageable sizes, with a lot of unused junk in it if a lot of i
+		  //  place, and (2) regardless of 1, the store can possibly explode to 
+		  //  unmanageable sizes, with a lot of unused junk in it if a lot of
 		  //  annotatable objects are created and destroyed.
-
-		  //  Alas this is kinda expensive right now, but the data structure is
-		  //  set up to minimize search time, not deletion time.  It could
-		  //  be changed if this becomes a significant time drain.
-
-		  unsigned int n = 0;
-		  for (unsigned int i = 0; i < getAnnos()->size(); ++i)
-		  {
-			  annos_by_type_t *abt = (*getAnnos())[i];
-			  if (!abt) continue;
-
-			  annos_by_type_t::iterator iter = abt->find(this);
-			  if (iter != abt->end())
-			  {
-				  if (annotation_debug_flag())
-				  {
-					  fprintf(stderr, "%s[%d]:  Sparse(%p) dtor remove %s-%d\n", FILE__, __LINE__,  
-							  this, AnnotationClassBase::findAnnotationClass(i) 
-							  ? AnnotationClassBase::findAnnotationClass(i)->getName().c_str() 
-							  : "bad_anno_id", i);
-				  }
-
-				  abt->erase(iter);
-				  n++;
-
-				  //  get rid of this check...  just making sure that erase is behaving as
-				  //  expected...
-				  annos_by_type_t::iterator iter2 = abt->find(this);
-				  if (iter2 != abt->end())
-					  fprintf(stderr, "%s[%d]:  FIXME:  REMOVE FAILED\n", FILE__, __LINE__);
-			  }
-		  }
+		  clearAnnotations();
 	  }
 
    private:
 
-#if defined (NON_STATIC_SPARSE_MAP)
-      //COMMON_EXPORT static annos_t *annos;
-#else
-      static annos_t annos;
-#endif
-	  annos_t *getAnnos() const;
-	  static dyn_hash_map<void *, unsigned short> ser_ndx_map;
-
-      annos_by_type_t *getAnnosOfType(AnnotationClassID aid, bool do_create =false) const
-	  {
-		  annos_t &l_annos = *getAnnos();
-         long nelems_to_create = aid - l_annos.size() + 1;
-
-         if (nelems_to_create > 0)
-         {
-            if (!do_create)
-            {
-               return NULL;
-            }
-
-            while (nelems_to_create)
-            {
-               annos_by_type_t *newl = new annos_by_type_t();
-               l_annos.push_back(newl);
-               nelems_to_create--;
-            }
-         }
-
-         annos_by_type_t *abt = l_annos[aid];
-
-         return abt;
-      }
-
-      template <class T>
-      AN_INLINE annos_by_type_t *getAnnosOfType(AnnotationClass<T> &a_id, bool do_create =false) const
-      {
-         AnnotationClassID aid = a_id.getID();
-
-		 return getAnnosOfType(aid, do_create);
-	  }
-
-
-      void *getAnnosForObject(annos_by_type_t *abt,
-            void *obj, bool do_create = false) const 
-      {
-         assert(abt);
-         assert(obj);
-
-         void  *target = NULL;
-
-         annos_by_type_t::iterator iter = abt->find(obj);
+	  //  Sparse annotations live in a process-wide store (see Annotatable.C),
+	  //  split into shards by object address with a lock per shard.  Each
+	  //  object's annotations are an array indexed by annotation id, so an
+	  //  access is one hash lookup in one shard, and threads annotating
+	  //  different objects rarely contend.
+	  void *getAnnotationByID(AnnotationClassID aid) const;
+	  //  Returns true if this replaced an existing annotation of the type
+	  bool setAnnotationByID(AnnotationClassID aid, void *a);
+	  bool removeAnnotationByID(AnnotationClassID aid);
+	  void clearAnnotations();
+	  //  Snapshot of (id, annotation) pairs, in id order
+	  void getAllAnnotations(std::vector<std::pair<AnnotationClassID, void *> > &annos) const;
 
-         if (iter == abt->end())
-         {
-            if (!do_create)
-            {
-               return NULL;
-            }
-
-            (*abt)[obj] = target;
-         }
-         else
-         {
-            target = iter->second;
-         }
-
-         return target;
-      }
+	  static dyn_hash_map<void *, unsigned short> ser_ndx_map;
 
 	  //  private version of addAnnotation used by deserialize function to restore
 	  //  annotation set without explicitly specifying types
@@ -628,34 +543,11 @@ class COMMON_EXPORT AnnotatableSparse
 					  : "bad_anno_id", aid);
 		  }
 
-		  void *obj = this;
-		  annos_by_type_t *abt = getAnnosOfType(aid, true /*do create if needed*/);
-		  assert(abt);
-
-		  annos_by_type_t::iterator iter = abt->find(obj);
-		  if (iter == abt->end())
-		  {
-			  (*abt)[obj] = const_cast<void *>(a);
-		  }
-		  else
-		  {
-			  //  do silent replacement -- this case can arise if an annotatable object
-			  //  is destroyed and then reallocated as a new object at the same address.
-			  //  Given the sparse map data structure, it would be rather expensive to 
-			  //  go through the map in the dtor to eliminate references to the 
-			  //  destroyed object.
-
-			  //  Added annotation removal in dtor...  so this case should _not_ arise,
-			  //  do the replacement, but make some noise:
-
-			  if (a != iter->second)
-			  {
-				  annotatable_printf("%s[%d]:  WEIRD:  already have annotation of this type: %p, replacing with %p\n", FILE__, __LINE__, iter->second, a);
-				  iter->second = const_cast<void *>(a);
-			  }
-
-			  return true;
-		  }
+		  //  Replacement can only happen if an annotatable object is destroyed
+		  //  and reallocated at the same address, which the dtor guards against,
+		  //  so just make some noise:
+		  if (setAnnotationByID(aid, const_cast<void *>(a)))
+			  annotatable_printf("%s[%d]:  WEIRD:  already had annotation of this type, replaced with %p\n", FILE__, __LINE__, a);
 
 		  return true;
 	  }
@@ -664,120 +556,59 @@ class COMMON_EXPORT AnnotatableSparse
 
 	  bool operator==(AnnotatableSparse &cmp)
 	  {
-		  annos_t &l_annos = *getAnnos();
-		  unsigned this_ntypes = l_annos.size();
-         unsigned cmp_ntypes = cmp.getAnnos()->size();
-         unsigned ntypes = (cmp_ntypes > this_ntypes) ? cmp_ntypes : this_ntypes;
-
-         for (unsigned int i = 0; i < ntypes; ++i) 
-         {
-            if ((i >= cmp_ntypes) || (i >= this_ntypes)) 
-            {
-               //  compare is done since at least one set of annotations
-               //  has been exhausted
-               break;
-            }
-
-            annos_by_type_t *this_abt = l_annos[i];
-            annos_by_type_t *cmp_abt = (*cmp.getAnnos())[i];
-
-            if (!this_abt) 
-            {
-               fprintf(stderr, "%s[%d]:  WEIRD: FIXME\n", FILE__, __LINE__);
-               continue;
-            }
+		  std::vector<std::pair<AnnotationClassID, void *> > this_annos, cmp_annos;
+		  getAllAnnotations(this_annos);
+		  cmp.getAllAnnotations(cmp_annos);
 
-            if (!cmp_abt) 
-            {
-               fprintf(stderr, "%s[%d]:  WEIRD: FIXME\n", FILE__, __LINE__);
-               continue;
-            }
-
-            annos_by_type_t::iterator this_abt_iter = this_abt->find(this);
-            annos_by_type_t::iterator cmp_abt_iter = cmp_abt->find(&cmp);
-
-            //  if one has annotations of this particular type and other other
-            //  doesn't, then we are def. not equal, so fail:
-
-            if (this_abt_iter == this_abt->end())
-            {
-               if (cmp_abt_iter != cmp_abt->end())
-               {
-                  return false;
-               }
-
-               //  both are at end()
-               continue;
-            }
-
-            if (   (cmp_abt_iter == cmp_abt->end())
-                  && (this_abt_iter != this_abt->end()))
-            {
-               return false;
-            }
-
-            AnnotationClassBase *acb = AnnotationClassBase::findAnnotationClass(i);
-
-            if (!acb)
-            {
-               return false;
-            }
+		  unsigned i = 0, j = 0;
+		  while (i < this_annos.size() || j < cmp_annos.size())
+		  {
+			  //  if one has annotations of a particular type and the other
+			  //  doesn't, then we are def. not equal, so fail:
+			  if (i == this_annos.size() || j == cmp_annos.size() ||
+					  this_annos[i].first != cmp_annos[j].first)
+			  {
+				  return false;
+			  }
 
-            //  both have annotation -- do the compare
-            anno_cmp_func_t cmpfunc = acb->getCmpFunc();
+			  AnnotationClassID id = this_annos[i].first;
+			  AnnotationClassBase *acb = AnnotationClassBase::findAnnotationClass(id);
 
-            if (!cmpfunc)
-            {
-               //  even if not explicitly specified, a default pointer-compare
-               //  function should be returned here.
+			  if (!acb)
+			  {
+				  return false;
+			  }
 
-               fprintf(stderr, "%s[%d]:  no cmp func for anno id %d\n", 
-                     FILE__, __LINE__, i);
-               return false;
-            }
+			  //  both have annotation -- do the compare
+			  anno_cmp_func_t cmpfunc = acb->getCmpFunc();
 
-            void *arg1 = cmp_abt_iter->second;
-            void *arg2 = this_abt_iter->second;
+			  if (!cmpfunc)
+			  {
+				  //  even if not explicitly specified, a default pointer-compare
+				  //  function should be returned here.
 
-            bool ret = (*cmpfunc)(arg1, arg2);
+				  fprintf(stderr, "%s[%d]:  no cmp func for anno id %d\n", 
+						  FILE__, __LINE__, id);
+				  return false;
+			  }
 
-            return ret;
-         }
+			  return (*cmpfunc)(cmp_annos[j].second, this_annos[i].second);
+		  }
 
-         return true;
-      }
+		  return true;
+	  }
 
       template<class T>
       AN_INLINE bool addAnnotation(const T *a, AnnotationClass<T> &a_id)
          {
 		  annotatable_printf("%s[%d]:  Sparse(%p):  Add %s-%d, %s\n", FILE__, __LINE__, 
 				  this, a_id.getName().c_str(), a_id.getID(), typeid(T).name());
-            void *obj = this;
-            annos_by_type_t *abt = getAnnosOfType(a_id, true /*do create if needed*/);
-            assert(abt);
 
-            annos_by_type_t::iterator iter = abt->find(obj);
-            if (iter == abt->end())
-            {
-               (*abt)[obj] = (void *) const_cast<T *>(a);
-            }
-            else
+            if (setAnnotationByID(a_id.getID(), (void *) const_cast<T *>(a)))
             {
 				//  do silent replacement -- this case can arise if an annotatable object
 				//  is destroyed and then reallocated as a new object at the same address.
-				//  Given the sparse map data structure, it would be rather expensive to 
-				//  go through the map in the dtor to eliminate references to the 
-				//  destroyed object.
-
-				//  Added annotation removal in dtor...  so this case should _not_ arise,
-				//  do the replacement, but make some noise:
-
-				if (iter->second != a) 
-				{
-					//fprintf(stderr, "%s[%d]:  WEIRD:  already have annotation of type %s: %p, replacing with %p\n", FILE__, __LINE__, a_id.getName().c_str(), iter->second, a);
-					iter->second = (void *)const_cast<T *>(a);
-				}
-
+				//  The dtor removes annotations, so this case should _not_ arise.
 				return true;
             }
 
@@ -814,26 +645,8 @@ class COMMON_EXPORT AnnotatableSparse
       template<class T>
       AN_INLINE bool getAnnotation(T *&a, AnnotationClass<T> &a_id) const 
       {
-         a = NULL;
-
-         annos_by_type_t *abt = getAnnosOfType(a_id, false /*don't create if none*/);
-
-         if (!abt)
-         {
-            return false;
-         }
-
-         AnnotatableSparse * this_noconst = const_cast<AnnotatableSparse *>(this);
-         void *annos_for_object = getAnnosForObject(abt, (void *)this_noconst,
-               false /*no create if none*/);
-
-         if (!annos_for_object)
-         {
-            return false;
-         }
-
-         a = (T *)annos_for_object;
-         return true;
+         a = (T *) getAnnotationByID(a_id.getID());
+         return (a != NULL);
       }
 
 	  template<class T>
@@ -845,43 +658,20 @@ class COMMON_EXPORT AnnotatableSparse
 					  this, a_id.getName().c_str(), a_id.getID(), typeid(T).name());
 		  }
 
-		  void *obj = this;
-		  annos_by_type_t *abt = getAnnosOfType(a_id, false /*do create if needed*/);
-		  assert(abt);
-
-		  annos_by_type_t::iterator iter = abt->find(obj);
-		  if (iter == abt->end())
-		  {
-			  //  annotation does not exist, so we return false (remove failed)
-			  return false;
-		  }
-		  else
-		  {
-			  abt->erase(iter);
-			  return true;
-		  }
-	      return false;
+		  //  returns false if the annotation does not exist (remove failed)
+		  return removeAnnotationByID(a_id.getID());
 	  }
 
     void serializeAnnotations(SerializerBase *sb, const char *)
 	  {
-		  annos_t &l_annos = *getAnnos();
 		  std::vector<ser_rec_t> my_sers;
-            void *obj = this;
 			if (is_output(sb))
 			{
-				for (AnnotationClassID id = 0; id < l_annos.size(); ++id)
+				std::vector<std::pair<AnnotationClassID, void *> > annos;
+				getAllAnnotations(annos);
+				for (unsigned i = 0; i < annos.size(); ++i)
 				{
-					annos_by_type_t *abt = getAnnosOfType(id, false /*don't do create */);
-					if (NULL == abt) continue;
-
-					annos_by_type_t::iterator iter = abt->find(obj);
-
-					if (iter == abt->end()) 
-					{
-						//	fprintf(stderr, "%s[%d]:  nothing for this obj\n", FILE__, __LINE__);
-						continue;
-					}
+					AnnotationClassID id = annos[i].first;
 
 					//  we have an annotation of this type for this object, find the serialization
 					//  function and call it (if it exists)
@@ -902,7 +692,7 @@ class COMMON_EXPORT AnnotatableSparse
 
 					ser_rec_t sr;
 					sr.acb = acb;
-					sr.data = iter->second;
+					sr.data = annos[i].second;
 					sr.parent_id = (void *) this;
 					sr.sod = sparse;
 					my_sers.push_back(sr);
@@ -929,21 +719,12 @@ class COMMON_EXPORT AnnotatableSparse
 	  void annotationsReport()
 	  {
 		  std::vector<AnnotationClassBase *> atypes;
-		  annos_t &l_annos = *getAnnos();
+		  std::vector<std::pair<AnnotationClassID, void *> > annos;
+		  getAllAnnotations(annos);
 
-		  for (AnnotationClassID id = 0; id < l_annos.size(); ++id)
+		  for (unsigned i = 0; i < annos.size(); ++i)
 		  {
-			  annos_by_type_t *abt = getAnnosOfType(id, false /*don't do create */);
-			  if (NULL == abt) continue;
-
-			  annos_by_type_t::iterator iter = abt->find(this);
-
-			  if (iter == abt->end()) 
-			  {
-				  //	fprintf(stderr, "%s[%d]:  nothing for this obj\n", FILE__, __LINE__);
-				  continue;
-			  }
-
+			  AnnotationClassID id = annos[i].first;
 			  AnnotationClassBase *acb =  AnnotationClassBase::findAnnotationClass(id);
 			  if (!acb)
 			  {
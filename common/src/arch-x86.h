@@ -951,6 +951,15 @@ enum dynamic_call_address_mode {
 COMMON_EXPORT unsigned get_instruction(const unsigned char *instr, unsigned &instType,
 			 const unsigned char** op_ptr = NULL);
 
+/*
+   ia32_decode_length: size and legacy type of the instruction at instr, as
+   get_instruction computes them, without building a full ia32_instruction
+   for the common encodings. If prefixCount is non-NULL it receives the
+   number of prefix bytes.
+*/
+COMMON_EXPORT unsigned ia32_decode_length(const unsigned char *instr, unsigned &instType,
+                                          unsigned *prefixCount = NULL);
+
 /* get the target of a jump or call */
 COMMON_EXPORT Address get_target(const unsigned char *instr, unsigned type, unsigned size,
 		   Address addr);
@@ -40,6 +40,22 @@ unsigned long long PDYN_mulMillion(unsigned long long in);
 
 COMMON_EXPORT bool PtraceBulkRead(Dyninst::Address inTraced, unsigned size, void *inSelf, int pid);
 
+/* Reads count scattered ranges, remote[i] into local[i], batching them into
+ * as few process_vm_readv calls as possible.  Ranges that can't be read that
+ * way are retried one at a time with PtraceBulkRead.  ok[i] receives the
+ * status of each range; returns true if all were read. */
+struct iovec;
+COMMON_EXPORT bool PtraceBulkReadV(const struct iovec *remote, const struct iovec *local,
+                                   unsigned count, bool *ok, int pid);
+
+/* The same transfers using only process_vm_readv/writev.  These don't need
+ * to run on the tracer thread; false means the caller should fall back to
+ * the Ptrace versions.  ProcessVMReadV marks each range in ok[]. */
+COMMON_EXPORT bool ProcessVMRead(Dyninst::Address inTraced, unsigned size, void *inSelf, int pid);
+COMMON_EXPORT bool ProcessVMReadV(const struct iovec *remote, const struct iovec *local,
+                                  unsigned count, bool *ok, int pid);
+COMMON_EXPORT bool ProcessVMWrite(Dyninst::Address inTraced, unsigned size, const void *inSelf, int pid);
+
 COMMON_EXPORT bool PtraceBulkWrite(Dyninst::Address inTraced, unsigned size, const void *inSelf, int pid);
 
 COMMON_EXPORT bool findProcLWPs(pid_t pid, std::vector<pid_t> &lwps);
@@ -355,6 +355,17 @@ public:
   // prior results from the Graph
   // are substituted into anything that uses them.
   DATAFLOW_EXPORT static Retval_t expand(Dyninst::Graph::Ptr slice, DataflowAPI::Result_t &res);
+
+  // Raw (pre-visitor) expansions are memoized process-wide, keyed by
+  // instruction address, instruction bytes and output region, and bounded
+  // by the number of instruction addresses kept.  Memoized ASTs are
+  // hash-consed, so structurally equal subtrees are stored once; expand
+  // always returns a fresh copy that the caller may modify.
+  DATAFLOW_EXPORT static void setExpandCacheSize(unsigned max_insns);
+  DATAFLOW_EXPORT static void clearExpandCache();
+  DATAFLOW_EXPORT static void getExpandCacheStats(unsigned long &hits,
+                                                  unsigned long &misses,
+                                                  unsigned long &shared_nodes);
   
  private:
 
@@ -0,0 +1,167 @@
+/*
+ * See the dyninst/COPYRIGHT file for copyright information.
+ * 
+ * We provide the Paradyn Tools (below described as "Paradyn")
+ * on an AS IS basis, and do not warrant its validity or performance.
+ * We reserve the right to update, modify, or discontinue this
+ * software at any time.  We shall have no obligation to supply such
+ * updates or modifications or any other form of support to you.
+ * 
+ * By your use of Paradyn, you understand and agree that we (or any
+ * other person or entity with proprietary rights in Paradyn) are
+ * under no obligation to provide either maintenance services,
+ * update services, notices of latent defects, or correction of
+ * defects for Paradyn.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+// Reaching definitions for every assignment in a function, computed
+// once and stored in dense tables so that a use can be mapped to the
+// assignments that may define it in constant time.
+
+#if !defined(_DEFUSE_H_)
+#define _DEFUSE_H_
+
+#include <vector>
+#include <map>
+#include <utility>
+
+#include "dyntypes.h"
+#include "Absloc.h"
+#include "AbslocInterface.h"
+
+namespace Dyninst {
+
+namespace ParseAPI {
+  class Block;
+  class Function;
+  class CodeObject;
+};
+
+namespace DataflowAPI {
+  class CFGWatcher;
+};
+
+// Assignments are numbered in block order, and all assignments of an
+// instruction are numbered consecutively. Each input of an assignment
+// is a "use" with its own number. Definitions and uses are matched the
+// same way the slicer matches them: a use of region R is reached by an
+// assignment whose output R contains, and a precise definition of
+// such a region (or a call clobbering a register in R) ends the search.
+class DefUseGraph {
+ public:
+  typedef std::vector<unsigned>::const_iterator iterator;
+  typedef std::pair<iterator, iterator> range;
+
+  // Pseudo-definition for values flowing in from function entry
+  static const unsigned Entry = (unsigned) -1;
+
+  DATAFLOW_EXPORT DefUseGraph(ParseAPI::Function *func, bool stackAnalysis = true);
+  DATAFLOW_EXPORT ~DefUseGraph() {}
+
+  DATAFLOW_EXPORT ParseAPI::Function *func() const { return func_; }
+
+  DATAFLOW_EXPORT unsigned numAssignments() const { return assigns_.size(); }
+  DATAFLOW_EXPORT Assignment::Ptr assignment(unsigned id) const { return assigns_[id]; }
+  DATAFLOW_EXPORT ParseAPI::Block *block(unsigned id) const { return blocks_[assignBlock_[id]]; }
+  DATAFLOW_EXPORT bool lookup(Assignment::Ptr a, unsigned &id) const;
+  // The assignments of the instruction at addr are [first, last)
+  DATAFLOW_EXPORT bool assignmentsAt(Address addr, unsigned &first, unsigned &last) const;
+
+  // Dense numbering over every AbsRegion defined or used
+  DATAFLOW_EXPORT unsigned numRegions() const { return regions_.size(); }
+  DATAFLOW_EXPORT const AbsRegion &region(unsigned r) const { return regions_[r]; }
+  DATAFLOW_EXPORT unsigned defRegion(unsigned id) const { return defRegion_[id]; }
+
+  DATAFLOW_EXPORT unsigned numUses() const { return useRegion_.size(); }
+  DATAFLOW_EXPORT unsigned use(unsigned id, unsigned input) const { return useStart_[id] + input; }
+  DATAFLOW_EXPORT unsigned useAssignment(unsigned u) const { return useOwner_[u]; }
+  DATAFLOW_EXPORT unsigned useInput(unsigned u) const { return u - useStart_[useOwner_[u]]; }
+  DATAFLOW_EXPORT unsigned useRegion(unsigned u) const { return useRegion_[u]; }
+
+  // Assignments (or Entry) that may define use u
+  DATAFLOW_EXPORT range defs(unsigned u) const {
+    return range(defs_.begin() + defStart_[u], defs_.begin() + defStart_[u + 1]);
+  }
+  DATAFLOW_EXPORT range defs(unsigned id, unsigned input) const { return defs(use(id, input)); }
+
+  // Uses that assignment id may reach
+  DATAFLOW_EXPORT range uses(unsigned id) const {
+    return range(uses_.begin() + usesStart_[id], uses_.begin() + usesStart_[id + 1]);
+  }
+
+ private:
+  void numberBlocks();
+  void convert(bool stackAnalysis);
+  unsigned regionId(const AbsRegion &r);
+  bool kills(unsigned useReg, unsigned id) const;
+  void link();
+
+  ParseAPI::Function *func_;
+
+  // blocks in reverse postorder from the entry, with intraprocedural
+  // predecessors as index lists
+  std::vector<ParseAPI::Block *> blocks_;
+  std::vector<std::vector<unsigned> > preds_;
+  // assignments of block b are [blockStart_[b], blockStart_[b+1])
+  std::vector<unsigned> blockStart_;
+
+  std::vector<Assignment::Ptr> assigns_;
+  std::vector<unsigned> assignBlock_;
+  std::vector<unsigned> defRegion_;
+  std::vector<bool> isCall_;
+  std::map<Address, std::pair<unsigned, unsigned> > byAddr_;
+
+  std::vector<AbsRegion> regions_;
+  std::map<AbsRegion, unsigned> regionIds_;
+
+  std::vector<unsigned> useStart_;
+  std::vector<unsigned> useOwner_;
+  std::vector<unsigned> useRegion_;
+
+  std::vector<unsigned> defStart_;
+  std::vector<unsigned> defs_;
+  std::vector<unsigned> usesStart_;
+  std::vector<unsigned> uses_;
+};
+
+// Builds def-use graphs on demand and keeps them until the function's
+// CFG changes.
+class DefUseAnalyzer {
+ public:
+  DATAFLOW_EXPORT DefUseAnalyzer(bool stackAnalysis = true);
+  DATAFLOW_EXPORT ~DefUseAnalyzer();
+
+  DATAFLOW_EXPORT const DefUseGraph *get(ParseAPI::Function *func);
+
+  DATAFLOW_EXPORT void clean(ParseAPI::Function *func);
+  DATAFLOW_EXPORT void clean();
+
+  // Drop graphs for functions whose CFG changes in co; they are
+  // rebuilt on the next query. The analyzer must be destroyed
+  // before co is.
+  DATAFLOW_EXPORT void invalidateOnChange(ParseAPI::CodeObject *co);
+  DATAFLOW_EXPORT void invalidate(ParseAPI::Block *block);
+
+ private:
+  DataflowAPI::CFGWatcher *watcher;
+
+  bool stackAnalysis_;
+  std::map<ParseAPI::Function *, DefUseGraph *> graphs;
+};
+
+}
+
+#endif
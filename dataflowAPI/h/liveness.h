@@ -42,29 +42,52 @@
 #include "ABI.h"
 #include <map>
 #include <set>
+#include <vector>
 
 
 using namespace Dyninst;
 using namespace Dyninst::InstructionAPI;
 
-struct livenessData{
-	bitArray in, out, use, def;
-};
+namespace Dyninst { namespace DataflowAPI { class CFGWatcher; } }
 
 class DATAFLOW_EXPORT LivenessAnalyzer{
-	std::map<ParseAPI::Block*, livenessData> blockLiveInfo;
-	std::map<ParseAPI::Function*, bool> liveFuncCalculated;
-        std::map<ParseAPI::Function*, bitArray> funcRegsDefined;
+	// Per-function results, indexed by block number.  Blocks are numbered
+	// in postorder from the entry, the order a backwards problem settles
+	// fastest in; edges are kept as index ranges into succs/preds.  The
+	// in/out/use/def sets of block i are words [i*words, (i+1)*words) of
+	// the corresponding array.
+	struct funcLiveness {
+		std::vector<ParseAPI::Block*> blocks;
+		std::vector<std::pair<ParseAPI::Block*, unsigned> > index;   // sorted by block
+		unsigned words;
+		std::vector<unsigned long> in, out, use, def;
+		std::vector<unsigned> succStart, succs;
+		std::vector<unsigned> predStart, preds;
+		std::vector<bool> hasSink;
+		bitArray regsDefined;
+		// What a call to this function reads: the live-in set at its
+		// entry, never more than the ABI's call read set.  Callers whose
+		// results depend on it are dropped along with it.
+		bitArray callReads;
+		bool summarized;
+		std::set<ParseAPI::Function*> users;
+		funcLiveness() : words(0), summarized(false) {}
+	};
+	std::map<ParseAPI::Function*, funcLiveness*> funcInfo;
 	InstructionCache cachedLivenessInfo;
 
-	const bitArray& getLivenessIn(ParseAPI::Block *block);
-	const bitArray& getLivenessOut(ParseAPI::Block *block, bitArray &allRegsDefined);
-	void processEdgeLiveness(ParseAPI::Edge* e, livenessData& data, ParseAPI::Block* block, const bitArray& allRegsDefined);
-	
-	void summarizeBlockLivenessInfo(ParseAPI::Function* func, ParseAPI::Block *block, bitArray &allRegsDefined);
-	bool updateBlockLivenessInfo(ParseAPI::Block *block, bitArray &allRegsDefined);
+	DataflowAPI::CFGWatcher *watcher;
+
+	funcLiveness *getFuncLiveness(ParseAPI::Function *func);
+	int blockNumber(funcLiveness *fl, ParseAPI::Block *block);
+	bitArray blockSet(funcLiveness *fl, const std::vector<unsigned long> &sets, unsigned i);
+	void numberBlocks(ParseAPI::Function *func, funcLiveness &fl);
+	void solve(funcLiveness &fl);
+
+	void summarizeBlockLivenessInfo(ParseAPI::Function* func, ParseAPI::Block *block, bitArray &use, bitArray &def, bitArray &allRegsDefined);
+	bitArray callReadRegisters(ParseAPI::Function *caller, ParseAPI::Block *blk);
 	
-	ReadWriteInfo calcRWSets(Instruction::Ptr curInsn, ParseAPI::Block* blk, Address a);
+	ReadWriteInfo calcRWSets(ParseAPI::Function *func, Instruction::Ptr curInsn, ParseAPI::Block* blk, Address a);
 
 	void* getPtrToInstruction(ParseAPI::Block *block, Address addr) const;	
 	bool isExitBlock(ParseAPI::Block *block);
@@ -77,6 +100,7 @@ public:
 	typedef enum {Before, After} Type;
 	typedef enum {Invalid_Location} ErrorType;
 	LivenessAnalyzer(int w);
+	~LivenessAnalyzer();
 	void analyze(ParseAPI::Function *func);
 
 	template <class OutputIterator>
@@ -100,6 +124,12 @@ public:
 	void clean(ParseAPI::Function *func);
 	void clean();
 
+	// Drop results for functions whose CFG changes in co (e.g. through
+	// CFGModifier); they are recomputed on the next query.  The analyzer
+	// must be destroyed before co is.
+	void invalidateOnChange(ParseAPI::CodeObject *co);
+	void invalidate(ParseAPI::Block *block);
+
 	int getIndex(MachRegister machReg);
 	ABI* getABI() { return abi;}
 
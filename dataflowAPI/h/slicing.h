@@ -50,6 +50,7 @@
 #include "AbslocInterface.h"
 
 #include <boost/functional/hash.hpp>
+#include <boost/thread/mutex.hpp>
 
 namespace Dyninst {
 
@@ -72,6 +73,7 @@ typedef boost::shared_ptr<Graph> GraphPtr;
  typedef boost::shared_ptr<InstructionAPI::Instruction> InstructionPtr;
 
  class Slicer;
+ class SliceIndex;
 
 // Used in temp slicer; should probably
 // replace OperationNodes when we fix up
@@ -142,6 +144,15 @@ class Slicer {
 	 ParseAPI::Function *func,
 	 bool cache = true,
 	 bool stackAnalysis = true);
+
+  // Slice using a shared index of decoded instructions and
+  // assignments (see SliceIndex below), so that several slices over
+  // the same function do not redo that work. The index must outlive
+  // the slicer.
+  DATAFLOW_EXPORT Slicer(AssignmentPtr a,
+	 ParseAPI::Block *block,
+	 ParseAPI::Function *func,
+	 SliceIndex *index);
     
   DATAFLOW_EXPORT static bool isWidenNode(Node::Ptr n);
 
@@ -192,13 +203,30 @@ class Slicer {
   
   DATAFLOW_EXPORT GraphPtr backwardSlice(Predicates &predicates);
 
+  // Work done by the most recent slice, for profiling
+  struct SliceStats {
+    SliceStats() : frames(0), cacheEdges(0), nodes(0), edges(0),
+                   budgetExhausted(false) {}
+    unsigned long frames;     // slice frames explored
+    unsigned long cacheEdges; // distinct instruction-to-instruction edges
+    unsigned nodes;           // nodes in the resulting graph
+    unsigned edges;           // slice edges inserted
+    bool budgetExhausted;
+  };
+
+  // Bound the number of frames a slice may explore; once the budget
+  // is spent, the remaining search is widened exactly as when the
+  // search runs off the rails. 0 (the default) means unbounded.
+  DATAFLOW_EXPORT void setBudget(unsigned long maxFrames) { budget_ = maxFrames; }
+  DATAFLOW_EXPORT const SliceStats &stats() const { return stats_; }
+
  private:
 
   typedef enum {
     forward,
     backward } Direction;
 
-  typedef std::map<ParseAPI::Block *, InsnVec> InsnCache;
+  typedef std::map<ParseAPI::Block *, boost::shared_ptr<InsnVec> > InsnCache;
 
   // Our slicing is context-sensitive; that is, if we enter
   // a function foo from a caller bar, all return edges
@@ -676,8 +704,16 @@ class Slicer {
 
   void mergeRecursiveCaches(std::map<Address, DefCache>& sc, std::map<Address, DefCache>& c, Address a);
 
+  // Blocks this slicer has looked at. Holding the vectors here keeps
+  // Location iterators valid even if the index re-decodes a block.
   InsnCache insnCache_;
 
+  boost::shared_ptr<SliceIndex> ownIndex_;
+  SliceIndex *index_;
+
+  unsigned long budget_;
+  SliceStats stats_;
+
   AssignmentPtr a_;
   ParseAPI::Block *b_;
   ParseAPI::Function *f_;
@@ -708,8 +744,6 @@ class Slicer {
   std::deque<Address> addrStack;
   std::set<Address> addrSet;
 
-  AssignmentConverter converter;
-
   SliceNode::Ptr widen_;
  public: 
   // A set of edges that have been visited during slicing,
@@ -718,6 +752,60 @@ class Slicer {
   std::set<ParseAPI::Edge*> visitedEdges;
 };
 
+// Decoded instructions and their assignments, shared by every slice
+// taken over a function. Entries are kept per block and re-derived if
+// the block's extent changes (e.g. it is split during parsing), so the
+// index stays usable while the function is still growing. Indices
+// obtained from get() live in an annotation on the function until
+// release() is called. The per-slice def-use cache is deliberately not
+// shared: what it records depends on the predicates and on the regions
+// that were active along each path.
+class SliceIndex {
+ public:
+  DATAFLOW_EXPORT SliceIndex(bool cacheAssignments = true, bool stackAnalysis = true);
+  DATAFLOW_EXPORT ~SliceIndex() {}
+
+  DATAFLOW_EXPORT static SliceIndex *get(ParseAPI::Function *func,
+                                         bool stackAnalysis = true);
+  DATAFLOW_EXPORT static void release(ParseAPI::Function *func);
+
+  // The decoded instructions of a block
+  DATAFLOW_EXPORT boost::shared_ptr<Slicer::InsnVec> insns(ParseAPI::Block *block);
+
+  DATAFLOW_EXPORT void convert(InstructionPtr insn,
+                               Address addr,
+                               ParseAPI::Function *func,
+                               ParseAPI::Block *block,
+                               std::vector<AssignmentPtr> &assignments);
+
+  // Drop what is known about a block, or about everything. Needed
+  // with stack analysis enabled when the function's CFG changes,
+  // since stack heights are not tied to a single block's extent.
+  DATAFLOW_EXPORT void invalidate(ParseAPI::Block *block);
+  DATAFLOW_EXPORT void invalidate();
+
+  DATAFLOW_EXPORT void getStats(unsigned long &hits, unsigned long &misses) const;
+
+ private:
+  struct BlockEntry {
+    BlockEntry() : start(0), end(0) {}
+    Address start;
+    Address end;
+    boost::shared_ptr<Slicer::InsnVec> insns;
+    std::map<std::pair<Address, ParseAPI::Function *>,
+             std::vector<AssignmentPtr> > assignments;
+  };
+
+  BlockEntry &entry(ParseAPI::Block *block);
+
+  std::map<ParseAPI::Block *, BlockEntry> blocks_;
+  bool cacheAssignments_;
+  AssignmentConverter converter_;
+  unsigned long hits_;
+  unsigned long misses_;
+  mutable boost::mutex lock_;
+};
+
 }
 
 #endif
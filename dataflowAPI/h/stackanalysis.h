@@ -65,6 +65,7 @@ namespace Dyninst {
       class Function;
       class Block;
       class Edge;
+      class CodeObject;
    };
    namespace InstructionAPI {
       class Instruction;
@@ -358,6 +359,21 @@ public:
    DATAFLOW_EXPORT bool canGetFunctionSummary();
    DATAFLOW_EXPORT bool getFunctionSummary(TransferSet &summary);
 
+   // Analyzes every function in co bottom-up over the call graph, so calls
+   // use their callee's function summary; call-graph cycles are iterated to
+   // a fixed point.  Functions whose callees are done run on up to
+   // num_threads threads (0 means one per core).  Results are kept as
+   // annotations on each Function, where later StackAnalysis objects for it
+   // find them.  Summaries, keyed by entry address, are returned through
+   // summaries if it is given.  With persist set and a cache directory on
+   // co (CodeObject::setCacheDirectory), the summaries are saved beside
+   // the cached CFG, and a later run over the same binary starts from
+   // them instead of recomputing them.
+   DATAFLOW_EXPORT static bool analyzeAll(ParseAPI::CodeObject *co,
+      unsigned num_threads = 0,
+      std::map<Address, TransferSet> *summaries = NULL,
+      bool persist = false);
+
    DATAFLOW_EXPORT void debug();
 
 private:
@@ -0,0 +1,89 @@
+/*
+ * See the dyninst/COPYRIGHT file for copyright information.
+ * 
+ * We provide the Paradyn Tools (below described as "Paradyn")
+ * on an AS IS basis, and do not warrant its validity or performance.
+ * We reserve the right to update, modify, or discontinue this
+ * software at any time.  We shall have no obligation to supply such
+ * updates or modifications or any other form of support to you.
+ * 
+ * By your use of Paradyn, you understand and agree that we (or any
+ * other person or entity with proprietary rights in Paradyn) are
+ * under no obligation to provide either maintenance services,
+ * update services, notices of latent defects, or correction of
+ * defects for Paradyn.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+// Support shared by the per-function analyses that cache their results
+// (liveness, def-use): numbering a function's blocks, and dropping a
+// function's results when CFGModifier changes its CFG.
+
+#if !defined(_CFG_WATCHER_H_)
+#define _CFG_WATCHER_H_
+
+#include <set>
+#include <vector>
+#include <boost/function.hpp>
+
+#include "parseAPI/h/CFG.h"
+#include "parseAPI/h/ParseCallback.h"
+
+namespace Dyninst {
+namespace DataflowAPI {
+
+// Calls clean on every function a CFG change touches, in each CodeObject
+// it has been asked to watch.  It unregisters itself when destroyed.
+class CFGWatcher : public ParseAPI::ParseCallback {
+  public:
+    typedef boost::function<void (ParseAPI::Function *)> Cleaner;
+
+    CFGWatcher(Cleaner c) : clean(c) {}
+    ~CFGWatcher();
+
+    void watch(ParseAPI::CodeObject *co);
+    // clean every function that contains block
+    static void invalidate(ParseAPI::Block *block, const Cleaner &c);
+
+  protected:
+    // keep the base class's destroy_cb(Edge *) visible; edge changes
+    // reach us through the edge callbacks below
+    using ParseAPI::ParseCallback::destroy_cb;
+    virtual void split_block_cb(ParseAPI::Block *orig, ParseAPI::Block *) { invalidate(orig, clean); }
+    virtual void destroy_cb(ParseAPI::Block *b) { invalidate(b, clean); }
+    virtual void destroy_cb(ParseAPI::Function *f) { clean(f); }
+    virtual void remove_edge_cb(ParseAPI::Block *b, ParseAPI::Edge *, edge_type_t) { invalidate(b, clean); }
+    virtual void add_edge_cb(ParseAPI::Block *b, ParseAPI::Edge *, edge_type_t) { invalidate(b, clean); }
+    virtual void remove_block_cb(ParseAPI::Function *f, ParseAPI::Block *) { clean(f); }
+    virtual void add_block_cb(ParseAPI::Function *f, ParseAPI::Block *) { clean(f); }
+    virtual void modify_edge_cb(ParseAPI::Edge *e, ParseAPI::Block *b, edge_type_t);
+
+  private:
+    Cleaner clean;
+    std::set<ParseAPI::CodeObject *> watched;
+};
+
+// func's blocks in postorder over intraprocedural edges from its entry,
+// with the blocks unreachable from the entry appended in function order.
+// Sink edges are never followed; catch edges only if followCatch.
+// Returns the number of blocks reachable from the entry.
+unsigned postorderBlocks(ParseAPI::Function *func, bool followCatch,
+                     std::vector<ParseAPI::Block *> &order);
+
+}
+}
+
+#endif
@@ -33,6 +33,8 @@
 
 #include <stack>
 #include <vector>
+#include <map>
+#include <boost/thread/mutex.hpp>
 #include "dyntypes.h"
 #include "dyn_regs.h"
 #include "ProcReader.h"
@@ -98,25 +100,92 @@ class DYNDWARF_EXPORT DwarfFrameParser {
                            std::vector<VariableLocation> &locs,
                            FrameErrors_t &err_result);
 
+   // An unwind row in the shape compilers emit for ordinary frames: the
+   // CFA is a register plus an offset, and the return address and frame
+   // register are each saved at CFA + offset or left unchanged.  Rows
+   // cover the pcs [low, high].
+   typedef enum {
+      rule_unknown,
+      rule_same,
+      rule_saved
+   } saved_rule_t;
+
+   struct frame_rule {
+      Address low;
+      Address high;
+      bool cfa_known;
+      MachRegister cfa_reg;
+      long cfa_offset;
+      saved_rule_t ra_rule;
+      long ra_offset;
+      saved_rule_t fp_rule;
+      long fp_offset;
+   };
+
+   // Decodes every FDE into frame_rules, in address order, so a caller
+   // can unwind later without consulting the parser (e.g. from a signal
+   // handler).  An FDE also covered by .debug_frame is taken from there.
+   bool getFrameRules(MachRegister frame_reg,
+                      std::vector<frame_rule> &rules,
+                      FrameErrors_t &err_result);
+
 
   private:
 
+   // One row of an FDE's table for a single register: the rule libdwarf
+   // decoded, and the pcs [low, high] it covers.
+   struct cfa_rule {
+      Address low;
+      Address high;
+      Dwarf_Small value_type;
+      Dwarf_Signed offset_relevant;
+      Dwarf_Signed register_num;
+      Dwarf_Signed offset_or_block_len;
+      Dwarf_Ptr block_ptr;
+   };
+
+   // An FDE and the pcs [low, high] it covers.  Each register's rows are
+   // decoded the first time the register is asked for, so later lookups
+   // don't rerun the CFA program.  rules is only filled under fde_lock;
+   // the CIE's return-address column is read when the index is built.
+   struct fde_entry {
+      Address low;
+      Address high;
+      Dwarf_Fde fde;
+      bool have_ra_reg;
+      Dwarf_Half ra_reg;
+      std::map<Dwarf_Half, std::vector<cfa_rule> > rules;
+
+      bool operator<(const fde_entry &rhs) const { return low < rhs.low; }
+   };
+
    bool getRegAtFrame_aux(Address pc,
-                          Dwarf_Fde fde,
+                          fde_entry &fde,
                           Dwarf_Half dwarf_reg,
                           MachRegister orig_reg,
                           DwarfResult &cons,
                           Address &lowpc,
                           FrameErrors_t &err_result);
 
+   bool applyRule(Address pc,
+                  const cfa_rule &rule,
+                  Dwarf_Half dwarf_reg,
+                  MachRegister orig_reg,
+                  DwarfResult &cons,
+                  FrameErrors_t &err_result);
+
+   saved_rule_t toSavedRule(const cfa_rule &rule, long &offset);
+
+   const std::vector<cfa_rule> *getRules(fde_entry &fde,
+                                         Dwarf_Half dwarf_reg,
+                                         FrameErrors_t &err_result);
+
    bool getFDE(Address pc, 
-               Dwarf_Fde &fde, 
-               Address &low,
-               Address &high,
+               fde_entry *&fde,
                FrameErrors_t &err_result);
 
    bool getDwarfReg(MachRegister reg,
-                    Dwarf_Fde &fde,
+                    fde_entry &fde,
                     Dwarf_Half &dwarf_reg,
                     FrameErrors_t &err_result);
    
@@ -153,7 +222,13 @@ class DYNDWARF_EXPORT DwarfFrameParser {
    dwarf_status_t fde_dwarf_status;
 
    std::vector<fde_cie_data> fde_data;
+   // Parallel to fde_data; each list's FDEs sorted by address
+   std::vector<std::vector<fde_entry> > fde_index;
+   // Guards setting up fde_data/fde_index and decoding each FDE's rules,
+   // so queries may come from several threads
+   boost::mutex fde_lock;
    void setupFdeData();
+   void buildFdeIndex(const fde_cie_data &fc);
 
 
 
@@ -87,6 +87,12 @@ class DYNDWARF_EXPORT DwarfHandle {
    Dwarf_Debug *type_dbg();
    Dwarf_Debug *frame_dbg();
    DwarfFrameParserPtr frameParser();
+
+   // Opens a new libdwarf session over the same file as type_dbg().
+   // libdwarf sessions are not thread-safe, so concurrent DIE walkers
+   // each need their own. The error handler refers back to dbg, so it
+   // must stay at the same address until released with dwarf_finish.
+   bool openTypeDbg(Dwarf_Debug &dbg);
 };
 
 }
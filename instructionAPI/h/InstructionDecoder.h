@@ -49,6 +49,8 @@ namespace Dyninst
     /// end is reached.  At that point, all subsequent calls to \c decode will return a null %Instruction pointer.
     ///
       class InstructionDecoderImpl;
+      struct InstructionRecord;
+      struct InstructionDescriptor;
 
     class INSTRUCTION_EXPORT InstructionDecoder
     {
@@ -72,6 +74,20 @@ namespace Dyninst
       /// a null %Instruction pointer will be returned.  The %Instruction's \c size field will contain
       /// the size of the instruction decoded.
       Instruction::Ptr decode(const unsigned char* buffer);
+      /// Decode the current instruction into the caller-provided \c record, advancing past it
+      /// as \c decode() does.  No %Instruction, %Operation, or %Expression objects are
+      /// created and nothing is allocated; \c record.instruction() builds the full
+      /// %Instruction on request.  Returns false, leaving \c record invalid, at the end of the buffer.
+      bool decode(InstructionRecord& record);
+      /// Decode the instruction at \c buffer into \c record, as with \c decode(const unsigned char*).
+      bool decode(const unsigned char* buffer, InstructionRecord& record);
+      /// Decode consecutive instructions from the current position into the array \c out,
+      /// which has room for \c max descriptors, and return how many were written.  Decoding
+      /// stops after the first control flow instruction or the first illegal instruction
+      /// (both of which are written, the latter so the caller can tell why the run ended),
+      /// before an instruction that would extend past the end of the buffer, or when \c out is
+      /// full.  The decoder is left positioned after the last descriptor written.
+      unsigned int decodeBlock(InstructionDescriptor* out, unsigned int max);
       void doDelayedDecode(const Instruction* insn_to_complete);
       struct INSTRUCTION_EXPORT buffer
       {
@@ -90,6 +106,86 @@ namespace Dyninst
       boost::shared_ptr<InstructionDecoderImpl> m_Impl;
     };
 
+    /// An %InstructionRecord is a fixed-size, caller-owned description of one decoded
+    /// instruction: its size and raw bytes, opcode, category, and the kind of each explicit
+    /// operand.  It holds no pointers and may live on the stack or in arrays; decoding into
+    /// one is much cheaper than constructing an %Instruction.  Operand kinds are given in the
+    /// architecture's own encoding (for x86, the addressing method and operand type of the
+    /// Intel opcode tables) and are not described on other architectures.
+    struct INSTRUCTION_EXPORT InstructionRecord
+    {
+      static const unsigned int maxOperands = 4;
+      struct OperandInfo
+      {
+        unsigned short addrMethod;
+        unsigned short type;
+        bool isRead;
+        bool isWritten;
+      };
+
+      InstructionRecord() : id(e_No_Entry), category(c_NoCategory), arch(Arch_none),
+                            size(0), numOperands(0) {}
+
+      entryID id;
+      InsnCategory category;
+      Architecture arch;
+      unsigned int size;
+      unsigned int numOperands;
+      OperandInfo operands[maxOperands];
+      unsigned char raw[InstructionDecoder::maxInstructionLength];
+
+      /// True if the record holds a decoded instruction
+      bool isValid() const { return size != 0; }
+      /// True if the decoded bytes form a legal instruction
+      bool isLegalInsn() const { return id != e_No_Entry; }
+      bool isCall() const { return category == c_CallInsn; }
+      bool isReturn() const { return category == c_ReturnInsn; }
+      bool isBranch() const { return category == c_BranchInsn; }
+      /// True for any control flow instruction, system calls included
+      bool isControlFlow() const
+      {
+        return category == c_CallInsn || category == c_ReturnInsn ||
+               category == c_BranchInsn || category == c_SysEnterInsn ||
+               category == c_SyscallInsn;
+      }
+
+      /// Build the full %Instruction, with its operand expressions, from this record
+      Instruction::Ptr instruction() const;
+    };
+
+    /// An %InstructionDescriptor is the packed, 12-byte summary of one instruction produced by
+    /// \c InstructionDecoder::decodeBlock for linear sweeps over code.  Operand kinds are given
+    /// as in %InstructionRecord, truncated to a byte; the conditional and indirect flags are
+    /// only computed for x86.
+    struct INSTRUCTION_EXPORT InstructionDescriptor
+    {
+      enum
+      {
+        LEGAL = 0x01,
+        CALL = 0x02,
+        RETURN = 0x04,
+        BRANCH = 0x08,
+        SYSCALL = 0x10,
+        CONDITIONAL = 0x20,
+        INDIRECT = 0x40
+      };
+      static const unsigned int maxOperands = 4;
+
+      unsigned int id;
+      unsigned char size;
+      unsigned char flags;
+      unsigned char numOperands;
+      unsigned char category;
+      unsigned char operandKinds[maxOperands];
+
+      entryID getID() const { return (entryID) id; }
+      InsnCategory getCategory() const { return (InsnCategory) category; }
+      bool isLegalInsn() const { return (flags & LEGAL) != 0; }
+      bool isControlFlow() const { return (flags & (CALL | RETURN | BRANCH | SYSCALL)) != 0; }
+
+      void set(const InstructionRecord& rec);
+    };
+
   };
 };
 
@@ -37,6 +37,7 @@
 
 namespace NS_x86 {
 struct ia32_operand;
+struct ia32_entry;
 class ia32_instruction;
 }
 
@@ -70,6 +71,9 @@ namespace Dyninst
                 INSTRUCTION_EXPORT InstructionDecoder_x86(const InstructionDecoder_x86& o);
             public:
                 INSTRUCTION_EXPORT virtual Instruction::Ptr decode(InstructionDecoder::buffer& b);
+                virtual void decodeRecord(InstructionDecoder::buffer& b, InstructionRecord& rec);
+                virtual unsigned int decodeBlock(InstructionDecoder::buffer& b, InstructionDescriptor* out,
+                                                 unsigned int max);
       
                 INSTRUCTION_EXPORT virtual void setMode(bool is64);
                 virtual void doDelayedDecode(const Instruction* insn_to_complete);
@@ -93,6 +97,7 @@ namespace Dyninst
                 virtual Result_Type makeSizeType(unsigned int opType);
 
             private:
+                NS_x86::ia32_entry* decodeEntry(InstructionDecoder::buffer& b);
                 void doIA32Decode(InstructionDecoder::buffer& b);
 		bool isDefault64Insn();
 		
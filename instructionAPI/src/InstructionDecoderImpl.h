@@ -50,6 +50,9 @@ class InstructionDecoderImpl
         InstructionDecoderImpl(Architecture a) : m_Arch(a) {}
         virtual ~InstructionDecoderImpl() {}
         virtual Instruction::Ptr decode(InstructionDecoder::buffer& b);
+        virtual void decodeRecord(InstructionDecoder::buffer& b, InstructionRecord& rec);
+        virtual unsigned int decodeBlock(InstructionDecoder::buffer& b, InstructionDescriptor* out,
+                                         unsigned int max);
         virtual void doDelayedDecode(const Instruction* insn_to_complete) = 0;
         virtual void setMode(bool is64) = 0;
         static Ptr makeDecoderImpl(Architecture a);
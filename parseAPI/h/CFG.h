@@ -564,6 +564,8 @@ class PARSER_EXPORT Function : public allocatable, public AnnotatableSparse {
  private:
     void delayed_link_return(CodeObject * co, Block * retblk);
     void finalize();
+    /* drop analysis state that only lives while the function is parsed */
+    void release_parse_state();
 
     bool _parsed;
     bool _cache_valid;
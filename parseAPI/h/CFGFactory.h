@@ -158,6 +158,47 @@ class PARSER_EXPORT CFGFactory {
     fact_list<Function> funcs_;
 };
 
+/** A CFGFactory that carves Functions, Blocks and Edges out of large
+    contiguous slabs instead of allocating each object individually.
+    This removes per-object allocator overhead and keeps the CFG of
+    very large binaries dense in memory. Freed objects are recycled
+    through per-type free lists; the slabs themselves are released
+    when the factory is destroyed.
+
+    A Parser built with this factory also indexes each region's
+    blocks in sorted 32-bit index arrays rather than address hash
+    maps.
+
+    Like the default factory, this one is not internally synchronized;
+    ParseAPI serializes CFG construction around factory calls. **/
+
+class PARSER_EXPORT CompactCFGFactory : public CFGFactory {
+ public:
+    CompactCFGFactory();
+    virtual ~CompactCFGFactory();
+
+ protected:
+    virtual Function * mkfunc(Address addr, FuncSource src,
+            std::string name, CodeObject * obj, CodeRegion * region,
+            Dyninst::InstructionSource * isrc);
+    virtual Block * mkblock(Function * f, CodeRegion * r,
+            Address addr);
+    virtual Edge * mkedge(Block * src, Block * trg,
+            EdgeTypeEnum type);
+    virtual Block * mksink(CodeObject *obj, CodeRegion *r);
+
+    virtual void free_func(Function * f);
+    virtual void free_block(Block * b);
+    virtual void free_edge(Edge * e);
+
+ private:
+    class slab_pool;
+
+    slab_pool * func_pool_;
+    slab_pool * block_pool_;
+    slab_pool * edge_pool_;
+};
+
 
 
     }
@@ -97,6 +97,33 @@ class CodeObject {
     // `speculative' parsing
     PARSER_EXPORT void parseGaps(CodeRegion *cr, GapParsingType type=IdiomMatching);
 
+    // Number of threads used to parse; 1 (the default) parses
+    // sequentially. The DYNINST_PARSE_THREADS environment variable
+    // sets the initial value. Objects in defensive mode, or with
+    // parse callbacks registered, always parse sequentially.
+    PARSER_EXPORT void setParseThreads(unsigned n);
+    PARSER_EXPORT unsigned parseThreads() const;
+
+    // Directory for the persistent parse cache. When set, a full
+    // parse() first looks for a cached CFG of this exact binary
+    // (keyed by build-id and region contents) and rebuilds it
+    // without decoding; otherwise it parses and saves the result.
+    // The DYNINST_PARSE_CACHE environment variable sets the initial
+    // value; an empty string disables the cache.
+    PARSER_EXPORT void setCacheDirectory(std::string const& dir);
+    PARSER_EXPORT std::string cacheDirectory() const;
+    // Path in the cache directory for other results derived from
+    // this binary, keyed like its cached CFG and ending in suffix;
+    // empty while the cache is disabled.
+    PARSER_EXPORT std::string cachePath(std::string const& suffix);
+
+    // Lazy parsing. While enabled and until parse() is called, the
+    // lookup routines below parse only the function they touch;
+    // callees become unparsed stub functions that are parsed in turn
+    // when they are looked up or their blocks are requested.
+    PARSER_EXPORT void setLazyParsing(bool lazy);
+    PARSER_EXPORT bool lazyParsing() const;
+
     /** Lookup routines **/
 
     // functions
@@ -173,6 +173,13 @@ class PARSER_EXPORT CodeSource : public Dyninst::InstructionSource {
     virtual Address baseAddress() const { return 0; }
     virtual Address loadAddress() const { return 0; }
 
+    /*
+     * Identifier of the underlying binary (e.g. the ELF GNU build-id,
+     * as raw bytes), used to key persistent parse caches. Optional;
+     * empty if the binary does not carry one.
+     */
+    virtual std::string buildID() const { return std::string(); }
+
     std::map< Address, std::string > & linkage() const { return _linkage; }
     std::vector< Hint > const& hints() const { return _hints; } 
     std::vector<CodeRegion *> const& regions() const { return _regions; }
@@ -274,6 +281,7 @@ class PARSER_EXPORT SymtabCodeSource : public CodeSource {
     Address baseAddress() const;
     Address loadAddress() const;
     Address getTOC(Address addr) const;
+    std::string buildID() const;
     SymtabAPI::Symtab * getSymtabObject() {return _symtab;} 
 
     /** InstructionSource implementation **/
@@ -66,6 +66,7 @@ class IA_IAPI : public InstructionAdapter {
 
 		virtual ~IA_IAPI() {
         }
+        void setCurBlock(Dyninst::ParseAPI::Block *b) { _curBlk = b; }
         void reset(Dyninst::InstructionAPI::InstructionDecoder dec_,
           Address start, ParseAPI::CodeObject *o,
           ParseAPI::CodeRegion *r, InstructionSource *isrc, ParseAPI::Block *);
@@ -41,6 +41,7 @@
 #include "CFG.h"
 #include "ParserDetails.h"
 #include "debug_parse.h"
+#include "common/src/dthread.h"
 
 
 using namespace std;
@@ -145,9 +146,53 @@ class ParseFrame {
     ParseData * _pd;
 };
 
+/* Compact block index for a region, used in place of the address
+   hash map when the CodeObject's factory is a CompactCFGFactory.
+
+   Blocks live in struct-of-arrays arenas addressed by 32-bit indices
+   and are found by binary search over index arrays sorted by start
+   address: a large array, and a small one that new blocks are
+   inserted into and that is merged into the large one as it grows.
+   Callers hold the region lock. */
+class compact_region_index {
+ public:
+    typedef uint32_t index_t;
+    static const index_t none = 0xffffffff;
+
+    compact_region_index() { }
+
+    void insert(Block * b);
+    void remove(Block * b);
+    Block * find(Address start) const;
+
+    // all blocks, in address order
+    void blocks(vector<Block *> & out);
+
+ private:
+    size_t lower(const vector<index_t> & v, Address addr) const;
+    index_t lookup(Address start) const;
+    void merge();
+
+    // block arena
+    vector<Address> b_start_;
+    vector<Block *> b_block_;
+    vector<index_t> b_free_;    // dead slots
+
+    vector<index_t> sorted_;
+    vector<index_t> recent_;
+};
+
 /* per-CodeRegion parsing data */
 class region_data { 
  public:
+    // Guards the lookup structures below. Parsing threads may
+    // query and update a region concurrently; this lock is never
+    // held while acquiring any other lock.
+    Mutex<true> lock;
+
+    region_data() : compact(NULL) { }
+    ~region_data() { delete compact; }
+
   // Function lookups
   Dyninst::IBSTree_fast<FuncExtent> funcsByRange;
     dyn_hash_map<Address, Function *> funcsByAddr;
@@ -155,6 +200,8 @@ class region_data {
     // Block lookups
     Dyninst::IBSTree_fast<Block> blocksByRange;
     dyn_hash_map<Address, Block *> blocksByAddr;
+    // replaces blocksByAddr if set
+    compact_region_index * compact;
 
     // Parsing internals 
     dyn_hash_map<Address, ParseFrame *> frame_map;
@@ -165,6 +212,10 @@ class region_data {
     int findFuncs(Address addr, set<Function *> & funcs);
     int findBlocks(Address addr, set<Block *> & blocks);
 
+    void record_block(Block * b);
+    void remove_block(Block * b);
+    void allBlocks(vector<Block *> & blocks);
+
     /* 
      * Look up the next block for detection of straight-line
      * fallthrough edges into existing blocks.
@@ -174,6 +225,7 @@ class region_data {
         Block * nextBlock = NULL;
         Address nextBlockAddr = numeric_limits<Address>::max();
 
+        ScopeLock<Mutex<true> > l(lock);
         if((nextBlock = blocksByRange.successor(addr)) &&
            nextBlock->start() > addr)
         {
@@ -192,6 +244,7 @@ class region_data {
 inline Function *
 region_data::findFunc(Address entry)
 {
+    ScopeLock<Mutex<true> > l(lock);
     dyn_hash_map<Address, Function *>::iterator fit;
     if((fit = funcsByAddr.find(entry)) != funcsByAddr.end())
         return fit->second;
@@ -201,6 +254,9 @@ region_data::findFunc(Address entry)
 inline Block *
 region_data::findBlock(Address entry)
 {
+    ScopeLock<Mutex<true> > l(lock);
+    if(compact)
+        return compact->find(entry);
     dyn_hash_map<Address, Block *>::iterator bit;
     if((bit = blocksByAddr.find(entry)) != blocksByAddr.end())
         return bit->second;
@@ -215,6 +271,7 @@ region_data::findFuncs(Address addr, set<Function *> & funcs)
     set<FuncExtent *> extents;
     set<FuncExtent *>::iterator eit;
     
+    ScopeLock<Mutex<true> > l(lock);
     funcsByRange.find(addr,extents);
     for(eit = extents.begin(); eit != extents.end(); ++eit)
         funcs.insert((*eit)->func());
@@ -230,6 +287,7 @@ region_data::findFuncs(Address start, Address end, set<Function *> & funcs)
     set<FuncExtent *> extents;
     set<FuncExtent *>::iterator eit;
     
+    ScopeLock<Mutex<true> > l(lock);
     funcsByRange.find(&dummy,extents);
     for(eit = extents.begin(); eit != extents.end(); ++eit)
         funcs.insert((*eit)->func());
@@ -241,9 +299,43 @@ region_data::findBlocks(Address addr, set<Block *> & blocks)
 {
     int sz = blocks.size();
 
+    ScopeLock<Mutex<true> > l(lock);
     blocksByRange.find(addr,blocks);
     return blocks.size() - sz;
 }
+inline void
+region_data::record_block(Block * b)
+{
+    ScopeLock<Mutex<true> > l(lock);
+    if(compact)
+        compact->insert(b);
+    else
+        blocksByAddr[b->start()] = b;
+    blocksByRange.insert(b);
+}
+inline void
+region_data::remove_block(Block * b)
+{
+    ScopeLock<Mutex<true> > l(lock);
+    if(compact)
+        compact->remove(b);
+    else
+        blocksByAddr.erase(b->start());
+    blocksByRange.remove(b);
+}
+inline void
+region_data::allBlocks(vector<Block *> & blocks)
+{
+    ScopeLock<Mutex<true> > l(lock);
+    if(compact) {
+        compact->blocks(blocks);
+        return;
+    }
+    blocks.clear();
+    dyn_hash_map<Address, Block *>::iterator bit = blocksByAddr.begin();
+    for( ; bit != blocksByAddr.end(); ++bit)
+        blocks.push_back(bit->second);
+}
 
 
 /** end region_data **/
@@ -328,12 +420,12 @@ inline region_data * StandardParseData::findRegion(CodeRegion * /* cr */)
 }
 inline void StandardParseData::record_func(Function *f)
 {
+    ScopeLock<Mutex<true> > l(_rdata.lock);
     _rdata.funcsByAddr[f->addr()] = f;
 }
 inline void StandardParseData::record_block(CodeRegion * /* cr */, Block *b)
 {
-    _rdata.blocksByAddr[b->start()] = b;
-    _rdata.blocksByRange.insert(b);
+    _rdata.record_block(b);
 }
 
 /* OverlappingParseData handles binary code objects like .o files
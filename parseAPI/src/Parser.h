@@ -56,6 +56,7 @@ namespace Dyninst {
 namespace ParseAPI {
 
    class CFGModifier;
+   struct frame_sched;
 
 /** This is the internal parser **/
 class Parser {
@@ -109,6 +110,33 @@ class Parser {
     bool _in_parse;
     bool _in_finalize;
 
+    // Parallel parsing. With more than one thread, ParseFrames are
+    // distributed over a pool of workers; while they run (_sched is
+    // set), CFG mutation is serialized by _cfg_lock and indirect
+    // control flow analysis by _analysis_lock.
+    unsigned _num_threads;
+    Mutex<true> _cfg_lock;
+    Mutex<false> _analysis_lock;
+    frame_sched * _sched;
+
+    // Blocks split by another worker while their parser was still
+    // decoding or linking them, mapped to the tail holding the rest
+    // of the block (guarded by _cfg_lock)
+    std::map<Block *, Block *> _split_tails;
+    Block * split_tail(Block *b);
+    void publish_extent(Block *b, InstructionAdapter_t & ah);
+
+    // Directory holding persistent parse results; empty disables
+    // the cache (Parser-cache.C)
+    std::string _cache_dir;
+
+    // Lazy mode: lookups parse only the function they touch, and
+    // callees stay unparsed stubs until they are touched in turn
+    // (Parser-lazy.C). _lazy_index is the address-sorted view of
+    // sorted_funcs used to find the function containing an address.
+    bool _lazy;
+    vector<Function *> _lazy_index;
+
  public:
     Parser(CodeObject & obj, CFGFactory & fact, ParseCallbackManager & pcb);
     ~Parser();
@@ -136,6 +164,15 @@ class Parser {
     CFGFactory & factory() const { return _cfgfact; }
     CodeObject & obj() { return _obj; }
 
+    void set_num_threads(unsigned n) { _num_threads = (n ? n : 1); }
+    unsigned num_threads() const { return _num_threads; }
+
+    void set_cache_dir(std::string const& dir) { _cache_dir = dir; }
+    std::string const& cache_dir() const { return _cache_dir; }
+
+    void set_lazy(bool lazy) { _lazy = lazy; }
+    bool lazy() const { return _lazy; }
+
     // removal
     void remove_block(Block *);
     void remove_func(Function *);
@@ -146,6 +183,11 @@ class Parser {
     void record_block(Block *b);
     void record_func(Function *f);
 
+    // Return status of a function that other parse workers may be
+    // reading or updating
+    FuncReturnStatus retstatus(Function *f);
+    void set_retstatus(Function *f, FuncReturnStatus rs);
+
     void init_frame(ParseFrame & frame);
 
     void finalize(Function *f);
@@ -185,7 +227,30 @@ class Parser {
     void parse_frames(std::vector<ParseFrame *> &, bool);
     void parse_frame(ParseFrame & frame,bool);
 
+    /* parallel frame scheduling (Parser-parallel.C) */
+    bool parallel() const;
+    void parse_frames_parallel(std::vector<ParseFrame *> &, bool);
+    void parse_worker(unsigned worker);
+    void handle_frame_status(ParseFrame *, unsigned worker);
+    bool callee_pending(ParseFrame & frame, Function * ct);
+    void sort_edge_lists();
+
+    /* persistent CFG cache (Parser-cache.C) */
+    bool cache_enabled() const;
+    uint64_t cache_key();
+    std::string cache_path(uint64_t key, std::string const& suffix = ".cfg");
+    bool load_cache(uint64_t key);
+    void save_cache(uint64_t key);
+
+    /* lazy per-function parsing (Parser-lazy.C) */
+    bool lazy_lookup() const;
+    bool is_stub(Function * f);
+    void materialize(Function * f);
+    Function * materialize_at(CodeRegion * cr, Address addr);
+    void materialize_range(CodeRegion * cr, Address start, Address end);
+
     void resumeFrames(Function * func, vector<ParseFrame *> & work);
+    void record_delayed_frame(ParseFrame * pf);
     
     // defensive parsing details
     void tamper_post_processing(std::vector<ParseFrame *>&, ParseFrame *);
@@ -222,6 +287,19 @@ class Parser {
     bool getSyscallNumber(Function *, Block *, Address, Architecture, long int &);
 
     friend class CodeObject;
+    friend class cfg_guard;
+};
+
+/* Scoped hold of the Parser's CFG lock; a no-op unless parse workers
+   are running, so the sequential parser pays nothing for it. */
+class cfg_guard {
+    Mutex<true> * _m;
+ public:
+    cfg_guard(Parser & p) : _m(p._sched ? &p._cfg_lock : NULL)
+    {
+        if(_m) _m->lock();
+    }
+    ~cfg_guard() { if(_m) _m->unlock(); }
 };
 
 }
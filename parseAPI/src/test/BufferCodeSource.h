@@ -0,0 +1,109 @@
+/*
+ * See the dyninst/COPYRIGHT file for copyright information.
+ * 
+ * We provide the Paradyn Tools (below described as "Paradyn")
+ * on an AS IS basis, and do not warrant its validity or performance.
+ * We reserve the right to update, modify, or discontinue this
+ * software at any time.  We shall have no obligation to supply such
+ * updates or modifications or any other form of support to you.
+ * 
+ * By your use of Paradyn, you understand and agree that we (or any
+ * other person or entity with proprietary rights in Paradyn) are
+ * under no obligation to provide either maintenance services,
+ * update services, notices of latent defects, or correction of
+ * defects for Paradyn.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/* A CodeSource over a caller-supplied byte buffer, for tests that need
+   a known instruction sequence without reading a binary. */
+
+#if !defined(BUFFER_CODE_SOURCE_H)
+#define BUFFER_CODE_SOURCE_H
+
+#include <string>
+#include "CodeSource.h"
+
+namespace Dyninst {
+namespace ParseAPI {
+
+class BufferCodeRegion : public CodeRegion {
+ public:
+    BufferCodeRegion(Address base, const unsigned char *bytes, size_t len,
+                     Architecture arch) :
+        _base(base), _bytes(bytes), _len(len), _arch(arch) { }
+
+    bool isValidAddress(const Address a) const { return contains(a); }
+    void* getPtrToInstruction(const Address a) const
+    {
+        if (!contains(a)) return NULL;
+        return (void *) (_bytes + (a - _base));
+    }
+    void* getPtrToData(const Address a) const { return getPtrToInstruction(a); }
+    unsigned int getAddressWidth() const { return _arch == Arch_x86 ? 4 : 8; }
+    bool isCode(const Address a) const { return contains(a); }
+    bool isData(const Address) const { return false; }
+    bool isReadOnly(const Address) const { return true; }
+    Address offset() const { return _base; }
+    Address length() const { return _len; }
+    Architecture getArch() const { return _arch; }
+
+    Address low() const { return offset(); }
+    Address high() const { return offset() + length(); }
+
+ private:
+    Address _base;
+    const unsigned char *_bytes;
+    size_t _len;
+    Architecture _arch;
+};
+
+// One region, with a hint for each entry point added
+class BufferCodeSource : public CodeSource {
+ public:
+    BufferCodeSource(Address base, const unsigned char *bytes, size_t len,
+                     Architecture arch) :
+        _region(new BufferCodeRegion(base, bytes, len, arch))
+    {
+        addRegion(_region);
+    }
+    ~BufferCodeSource() { delete _region; }
+
+    void addEntry(Address a, std::string name)
+    {
+        _hints.push_back(Hint(a, _region, name));
+    }
+    CodeRegion *region() const { return _region; }
+
+    bool isValidAddress(const Address a) const { return _region->isValidAddress(a); }
+    void* getPtrToInstruction(const Address a) const { return _region->getPtrToInstruction(a); }
+    void* getPtrToData(const Address a) const { return _region->getPtrToData(a); }
+    unsigned int getAddressWidth() const { return _region->getAddressWidth(); }
+    bool isCode(const Address a) const { return _region->isCode(a); }
+    bool isData(const Address a) const { return _region->isData(a); }
+    bool isReadOnly(const Address a) const { return _region->isReadOnly(a); }
+    Address offset() const { return _region->offset(); }
+    Address length() const { return _region->length(); }
+    Architecture getArch() const { return _region->getArch(); }
+
+ private:
+    BufferCodeRegion *_region;
+};
+
+}
+}
+
+#endif
@@ -0,0 +1,78 @@
+/*
+ * See the dyninst/COPYRIGHT file for copyright information.
+ * 
+ * We provide the Paradyn Tools (below described as "Paradyn")
+ * on an AS IS basis, and do not warrant its validity or performance.
+ * We reserve the right to update, modify, or discontinue this
+ * software at any time.  We shall have no obligation to supply such
+ * updates or modifications or any other form of support to you.
+ * 
+ * By your use of Paradyn, you understand and agree that we (or any
+ * other person or entity with proprietary rights in Paradyn) are
+ * under no obligation to provide either maintenance services,
+ * update services, notices of latent defects, or correction of
+ * defects for Paradyn.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/* A comparable listing of every function, block and edge in a
+   CodeObject, for tests that check two parses build the same CFG. */
+
+#if !defined(CFG_SNAPSHOT_H)
+#define CFG_SNAPSHOT_H
+
+#include <cstdio>
+#include <set>
+#include <string>
+#include "CodeObject.h"
+#include "CFG.h"
+
+namespace Dyninst {
+namespace ParseAPI {
+
+inline std::set<std::string> cfgSnapshot(CodeObject &co)
+{
+    std::set<std::string> ret;
+    char buf[128];
+    const CodeObject::funclist &fl = co.funcs();
+    for (CodeObject::funclist::const_iterator fit = fl.begin(); fit != fl.end(); ++fit) {
+        Function *f = *fit;
+        snprintf(buf, sizeof(buf), "func %lx %s %d", f->addr(),
+                 f->name().c_str(), (int) f->retstatus());
+        ret.insert(buf);
+        Function::blocklist bl = f->blocks();
+        for (Function::blocklist::iterator bit = bl.begin(); bit != bl.end(); ++bit) {
+            Block *b = *bit;
+            snprintf(buf, sizeof(buf), "block %lx %lx-%lx", f->addr(),
+                     b->start(), b->end());
+            ret.insert(buf);
+            const Block::edgelist &targets = b->targets();
+            for (Block::edgelist::const_iterator eit = targets.begin(); eit != targets.end(); ++eit) {
+                Edge *e = *eit;
+                snprintf(buf, sizeof(buf), "edge %lx %lx %d %d", b->start(),
+                         e->sinkEdge() ? 0 : e->trg()->start(), (int) e->type(),
+                         (int) e->interproc());
+                ret.insert(buf);
+            }
+        }
+    }
+    return ret;
+}
+
+}
+}
+
+#endif
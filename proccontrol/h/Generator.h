@@ -40,6 +40,7 @@
 #include <set>
 #include <map>
 #include <string>
+#include <atomic>
 
 struct GeneratorMTInternals;
 class int_process;
@@ -67,6 +68,10 @@ class PC_EXPORT Generator
    
    void forceEventBlock();
 
+   //Number of times the generator woke up with OS events, and the total
+   // number of events it received.  events / wakeups is the batch size.
+   void getEventStats(unsigned long &wakeups, unsigned long &events) const;
+
    //State tracking
    typedef enum {
       none,
@@ -123,6 +128,9 @@ class PC_EXPORT Generator
 
   private:
    bool eventBlock_;
+   //Read by getEventStats from threads other than the generator's
+   std::atomic<unsigned long> stat_wakeups_;
+   std::atomic<unsigned long> stat_events_;
 };
 
 class PC_EXPORT GeneratorMT : public Generator
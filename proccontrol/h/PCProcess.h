@@ -464,6 +464,31 @@ class PC_EXPORT Process : public boost::enable_shared_from_this<Process>
    bool writeMemory(Dyninst::Address addr, const void *buffer, size_t size) const;
    bool readMemory(void *buffer, Dyninst::Address addr, size_t size) const;
 
+   /**
+    * Reads many scattered ranges at once.  Where the platform allows it
+    * the ranges are batched into a few system calls rather than one round
+    * trip each.  Each entry's err is set to err_none or the reason that
+    * range failed; returns true only if every range was read.
+    **/
+   struct read_t {
+      Dyninst::Address addr;
+      void *buffer;
+      size_t size;
+      err_t err;
+   };
+   bool readMemory(std::vector<read_t> &reads) const;
+
+   /**
+    * With the page cache enabled (it is off by default; StackwalkerAPI's
+    * ProcDebug turns it on), reads made while every thread is stopped are
+    * served from a page-granular snapshot of the process.  The snapshot is dropped when any thread continues or
+    * memory is written.  prefetchStackPages fills it with the pages above
+    * each stopped thread's stack pointer in one batch.
+    **/
+   void setPageCacheEnabled(bool b);
+   bool prefetchStackPages(size_t bytes_per_thread);
+   bool getPageCacheStats(unsigned long &hits, unsigned long &misses) const;
+
    bool writeMemoryAsync(Dyninst::Address addr, const void *buffer, size_t size, void *opaque_val = NULL) const;
    bool readMemoryAsync(void *buffer, Dyninst::Address addr, size_t size, void *opaque_val = NULL) const;
 
@@ -65,6 +65,7 @@ class int_thread;
 class int_threadPool;
 class handlerpool;
 class int_iRPC;
+class int_registerPool;
 
 typedef std::multimap<Dyninst::Address, Dyninst::ProcControlAPI::Process::ptr> int_addressSet;
 typedef std::set<Dyninst::ProcControlAPI::Process::ptr> int_processSet;
@@ -428,12 +429,21 @@ class int_process
    };
 
    bool readMem(Dyninst::Address remote, mem_response::ptr result, int_thread *thr = NULL);
+   bool readMemV(std::vector<Process::read_t> &reads, int_thread *thr = NULL);
    bool writeMem(const void *local, Dyninst::Address remote, size_t size, result_response::ptr result, int_thread *thr = NULL, bp_write_t bp_write = not_bp);
 
    virtual bool plat_readMem(int_thread *thr, void *local,
                              Dyninst::Address remote, size_t size) = 0;
    virtual bool plat_writeMem(int_thread *thr, const void *local,
                               Dyninst::Address remote, size_t size, bp_write_t bp_write) = 0;
+   //Platforms that can read several ranges in one operation override this;
+   // by default it loops over plat_readMem.  Sets err in each read_t.
+   virtual bool plat_readMemV(int_thread *thr, std::vector<Process::read_t> &reads);
+   //Platforms that can fetch several threads' registers in one operation
+   // override this; by default it loops over plat_getAllRegisters.  Sets
+   // full in each pool that was read.
+   virtual bool plat_getAllRegistersV(std::vector<int_thread *> &thrs,
+                                      std::vector<int_registerPool *> &pools);
 
    virtual async_ret_t plat_calcTLSAddress(int_thread *thread, int_library *lib, Offset off,
                                            Address &outaddr, std::set<response::ptr> &resps);
@@ -470,6 +480,7 @@ class int_process
                                                Process::MemoryRegion& memRegion);
 
    memCache *getMemCache();
+   pageCache *getPageCache();
 
    virtual bool plat_getOSRunningStates(std::map<Dyninst::LWP, bool> &runningStates) = 0;
 	// Windows-only technically
@@ -576,6 +587,7 @@ class int_process
    int continueSig;
    bool createdViaAttach;
    memCache mem_cache;
+   pageCache page_cache;
    Counter async_event_count;
    Counter force_generator_block_count;
    Counter startupteardown_procs;
@@ -978,6 +990,11 @@ public:
 
    //Register Management
    bool getAllRegisters(allreg_response::ptr result);
+   //Registers for several stopped threads of one process, fetched together.
+   // Threads whose full register set was already read this stop are served
+   // from cached_regpool.
+   static bool getAllRegistersV(const std::vector<int_thread *> &thrs,
+                                std::vector<allreg_response::ptr> &resps);
    bool getRegister(Dyninst::MachRegister reg, reg_response::ptr result);
    bool setAllRegisters(int_registerPool &pool, result_response::ptr result);
    bool setRegister(Dyninst::MachRegister reg, Dyninst::MachRegisterVal val, result_response::ptr result);
@@ -51,15 +51,31 @@
 #include "common/src/dthread.h"
 #include <sys/types.h>
 #include <sys/ptrace.h>
+#include <sys/uio.h>
 
 typedef enum __ptrace_request pt_req;
 
+class ArchEventLinux;
+
 class GeneratorLinux : public GeneratorMT
 {
   private:
    int generator_lwp;
    int generator_pid;
 
+   //Event-driven mode (DYNINST_GENERATOR_EPOLL): rather than sleeping in
+   // waitpid, sleep in epoll on a SIGCHLD signalfd and a wakeup eventfd,
+   // and decode every pending waitpid event in one pass.  The mutator must
+   // block SIGCHLD before it creates any threads, so that no thread takes
+   // the signal away from the signalfd; otherwise we stay with waitpid.
+   int epoll_fd;
+   int sigchld_fd;
+   int wake_fd;
+
+   bool initEpoll();
+   bool waitForChildEvent();
+   ArchEventLinux *pollEvent();
+
   public:
    GeneratorLinux();
    virtual ~GeneratorLinux();
@@ -67,6 +83,7 @@ class GeneratorLinux : public GeneratorMT
    virtual bool initialize();
    virtual bool canFastHandle();
    virtual ArchEvent *getEvent(bool block);
+   virtual bool getMultiEvent(bool block, std::vector<ArchEvent *> &events);
    void evictFromWaitpid();
 };
 
@@ -100,6 +117,8 @@ class DecoderLinux : public Decoder
    Dyninst::Address adjustTrapAddr(Dyninst::Address address, Dyninst::Architecture arch);
 };
 
+class LinuxPtrace;
+
 class linux_process : public sysv_process, public unix_process, public thread_db_process, public indep_lwp_control_process, public mmap_alloc_process, public int_followFork, public int_signalMask, public int_LWPTracking, public int_memUsage
 {
  public:
@@ -108,6 +127,8 @@ class linux_process : public sysv_process, public unix_process, public thread_db
    linux_process(Dyninst::PID pid_, int_process *p);
    virtual ~linux_process();
 
+   LinuxPtrace *getTracer() const;
+
    virtual bool plat_create();
    virtual bool plat_create_int();
    virtual bool plat_attach(bool allStopped, bool &);
@@ -131,6 +152,9 @@ class linux_process : public sysv_process, public unix_process, public thread_db
 
    virtual bool plat_readMem(int_thread *thr, void *local,
                              Dyninst::Address remote, size_t size);
+   virtual bool plat_readMemV(int_thread *thr, std::vector<Process::read_t> &reads);
+   virtual bool plat_getAllRegistersV(std::vector<int_thread *> &thrs,
+                                      std::vector<int_registerPool *> &pools);
    virtual bool plat_writeMem(int_thread *thr, const void *local,
                               Dyninst::Address remote, size_t size, bp_write_t bp_write);
    virtual SymbolReaderFactory *plat_defaultSymReader();
@@ -158,6 +182,9 @@ class linux_process : public sysv_process, public unix_process, public thread_db
 
   protected:
    int computeAddrWidth();
+
+  private:
+   LinuxPtrace *tracer;
 };
 
 class linux_x86_process : public linux_process, public x86_process
@@ -268,7 +295,10 @@ private:
       create_req,
       ptrace_req,
       ptrace_bulkread,
-      ptrace_bulkwrite
+      ptrace_bulkreadv,
+      ptrace_bulkwrite,
+      ptrace_bulkregs,
+      exit_req
    } req_t;
 
    req_t ptrace_request;
@@ -279,9 +309,17 @@ private:
    linux_process *proc;
    Dyninst::Address remote_addr;
    unsigned size;
+   const struct iovec *remote_iov;
+   const struct iovec *local_iov;
+   bool *iov_ok;
+   const pid_t *lwps;
+   struct iovec *reg_iov;
+   bool use_regset;
    long ret;
    bool bret;
    int err;
+   //Processes sharing this tracer; only counted for per-process tracers
+   int refs;
 
    DThread thrd;
    CondVar<> init;
@@ -292,16 +330,38 @@ private:
    void start_request();
    void waitfor_ret();
    void end_request();
+   void stop();
    static LinuxPtrace *linuxptrace;
+
+   //Which tracer owns each LWP when processes have their own tracers
+   static std::map<pid_t, LinuxPtrace *> lwp_tracers;
+   static Mutex<> lwp_tracers_lock;
 public:
    static LinuxPtrace *getPtracer();
+   static LinuxPtrace *getPtracer(pid_t lwp);
+
+   //With DYNINST_PTRACE_PER_PROCESS set, each created or attached process
+   // gets its own tracer thread (shared with its forked children) so
+   // ptrace traffic for many debuggees doesn't serialize on one thread.
+   static bool perProcessTracers();
+   static LinuxPtrace *newProcessTracer();
+   void addRef();
+   void release();
+   void addLWP(pid_t lwp);
+
    LinuxPtrace();
    ~LinuxPtrace();
    void start();
    void main();
    long ptrace_int(pt_req request_, pid_t pid_, void *addr_, void *data_);
    bool ptrace_read(Dyninst::Address inTrace, unsigned size_, void *inSelf, int pid_);
+   bool ptrace_readv(const struct iovec *remote, const struct iovec *local,
+                     unsigned count, bool *ok, int pid_);
    bool ptrace_write(Dyninst::Address inTrace, unsigned size_, const void *inSelf, int pid_);
+   //Fetch each LWP's registers into its iovec with one GETREGS (or
+   // GETREGSET NT_PRSTATUS) per LWP, all in a single tracer request.
+   bool ptrace_getregsv(pt_req request_, bool use_regset_, const pid_t *lwps_,
+                        struct iovec *areas, unsigned count, bool *ok);
 
    bool plat_create(linux_process *p);
 };
@@ -165,4 +165,41 @@ class memCache {
                                int_thread *writing_thrd = NULL);
 };
 
+/**
+ * Unlike memCache, pageCache is a plain read-through cache for arbitrary
+ * reads on synchronous platforms.  It holds whole target pages, and is
+ * only consulted during a stop epoch--while every thread in the process
+ * is stopped.  Any thread leaving the stopped state, or any write through
+ * int_process::writeMem, drops every page.
+ **/
+class pageCache {
+  private:
+   int_process *proc;
+   //Page address to page contents; NULL marks a page we failed to read
+   typedef std::map<Dyninst::Address, char *> pages_t;
+   pages_t pages;
+   bool enabled;
+   bool epoch_valid;
+   unsigned long hits;
+   unsigned long misses;
+
+   bool inStopEpoch();
+   bool fillPages(int_thread *thr, const std::set<Dyninst::Address> &page_addrs);
+  public:
+   pageCache(int_process *p);
+   ~pageCache();
+
+   //Copies [addr, addr+size) into dest.  Returns false if the cache can't
+   // serve the read right now; the caller should then read uncached.
+   bool read(int_thread *thr, void *dest, Dyninst::Address addr, unsigned long size);
+   //Reads every missing page touched by ranges in one batch
+   bool prefetch(int_thread *thr, const std::vector<std::pair<Dyninst::Address, unsigned long> > &ranges);
+   void invalidate();
+
+   void setEnabled(bool b);
+   bool isEnabled() const;
+   unsigned long getHits() const;
+   unsigned long getMisses() const;
+};
+
 #endif
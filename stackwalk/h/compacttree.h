@@ -0,0 +1,134 @@
+/*
+ * See the dyninst/COPYRIGHT file for copyright information.
+ * 
+ * We provide the Paradyn Tools (below described as "Paradyn")
+ * on an AS IS basis, and do not warrant its validity or performance.
+ * We reserve the right to update, modify, or discontinue this
+ * software at any time.  We shall have no obligation to supply such
+ * updates or modifications or any other form of support to you.
+ * 
+ * By your use of Paradyn, you understand and agree that we (or any
+ * other person or entity with proprietary rights in Paradyn) are
+ * under no obligation to provide either maintenance services,
+ * update services, notices of latent defects, or correction of
+ * defects for Paradyn.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef COMPACTTREE_H_
+#define COMPACTTREE_H_
+
+#include "basetypes.h"
+#include <string>
+#include <vector>
+#include <utility>
+#include <unordered_map>
+
+namespace Dyninst {
+namespace Stackwalker {
+
+class Frame;
+class FrameNode;
+class CallTree;
+class Walker;
+
+//A merged call tree sized for large jobs.  Frames are interned by
+// (object, offset), so the same frame seen in every thread and process is
+// stored once.  Names are looked up lazily, once per unique frame, and the
+// tree can be written to a byte buffer and read back elsewhere (e.g. to
+// ship a daemon's tree to a front-end, which merges them).
+class SW_EXPORT CompactCallTree {
+ public:
+   typedef unsigned frame_id_t;
+   typedef unsigned node_id_t;
+   static const node_id_t root = 0;
+
+   struct thread_t {
+      node_id_t leaf;
+      Dyninst::PID pid;
+      Dyninst::THR_ID thread;
+      bool had_error;
+   };
+
+   CompactCallTree();
+   ~CompactCallTree();
+
+   void addCallStack(const std::vector<Frame> &stk, Dyninst::THR_ID thrd, Walker *walker, bool err_stack);
+   void addCallTree(const CallTree &tree);
+   void merge(const CompactCallTree &other);
+   void clear();
+
+   //Looks up names for every frame that doesn't have one yet
+   void symbolize();
+
+   unsigned numNodes() const;
+   frame_id_t getNodeFrame(node_id_t n) const;
+   node_id_t getNodeParent(node_id_t n) const;
+   //Sorted by frame id
+   const std::vector<node_id_t> &getNodeChildren(node_id_t n) const;
+   const std::vector<thread_t> &getThreads() const;
+
+   unsigned numFrames() const;
+   //Frames outside any known library report an empty lib and their address
+   void getFrameLibOffset(frame_id_t f, std::string &lib, Dyninst::Offset &offset) const;
+   //Looks the name up on first use
+   bool getFrameName(frame_id_t f, std::string &name);
+
+   //with_names symbolizes any unnamed frames first and includes the names
+   void serialize(std::vector<unsigned char> &buffer, bool with_names = true);
+   bool deserialize(const unsigned char *buffer, size_t size);
+
+ private:
+   static const unsigned no_string = (unsigned) -1;
+
+   struct node_t {
+      frame_id_t frame;
+      node_id_t parent;
+      std::vector<node_id_t> children;
+   };
+   struct frame_t {
+      unsigned object;
+      Dyninst::Offset offset;
+      unsigned name;
+      bool lookup_failed;
+      //For the deferred name lookup; NULL in deserialized trees
+      Walker *walker;
+      Dyninst::Address ra;
+   };
+   typedef std::pair<unsigned, Dyninst::Offset> frame_key_t;
+   struct frame_key_hash {
+      size_t operator()(const frame_key_t &k) const;
+   };
+
+   std::vector<node_t> nodes;
+   std::vector<frame_t> frames;
+   std::vector<std::string> strings;
+   std::vector<thread_t> threads;
+   std::unordered_map<std::string, unsigned> string_ids;
+   std::unordered_map<frame_key_t, frame_id_t, frame_key_hash> frame_ids;
+
+   unsigned internString(const std::string &s);
+   frame_id_t internFrame(unsigned object, Dyninst::Offset offset);
+   frame_id_t internFrame(const Frame &f);
+   node_id_t getChild(node_id_t parent, frame_id_t f);
+   void resolveName(frame_t &f);
+   void addSubtree(const FrameNode *fn, node_id_t parent);
+};
+
+}
+}
+
+#endif
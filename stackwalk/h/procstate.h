@@ -127,6 +127,19 @@ class SW_EXPORT ProcDebug : public ProcessState {
    ProcDebug(Dyninst::ProcControlAPI::Process::ptr p);
 
    std::set<Dyninst::ProcControlAPI::Thread::ptr> needs_resume;
+
+   //Registers and stack tops captured by beginParallelWalk.  Reads that
+   // land in them don't go back through ProcControlAPI.
+   struct thread_snapshot_t {
+      std::map<Dyninst::MachRegister, Dyninst::MachRegisterVal> regs;
+      Dyninst::Address stack_start;
+      std::vector<unsigned char> stack;
+   };
+   std::map<Dyninst::THR_ID, thread_snapshot_t> snapshots;
+   std::map<Dyninst::Address, thread_snapshot_t *> snapshot_stacks;
+   std::set<Dyninst::ProcControlAPI::Thread::ptr> snapshot_stopped;
+   bool have_snapshot;
+   Dyninst::Architecture snapshot_arch;
  public:
   
   static ProcDebug *newProcDebug(Dyninst::PID pid, std::string executable="");
@@ -162,6 +175,12 @@ class SW_EXPORT ProcDebug : public ProcessState {
   virtual bool isFirstParty();
 
   virtual Dyninst::Architecture getArchitecture();
+
+  //Used by WalkerSet::walkStacksParallel.  Stops threads and captures
+  // their registers and the top stack_bytes of their stacks; walks are
+  // served from that capture until endParallelWalk resumes the threads.
+  bool beginParallelWalk(const std::vector<Dyninst::THR_ID> &threads, size_t stack_bytes);
+  void endParallelWalk();
 };
 
 //LibAddrPair.first = path to library, LibAddrPair.second = load address
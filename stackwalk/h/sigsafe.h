@@ -0,0 +1,109 @@
+/*
+ * See the dyninst/COPYRIGHT file for copyright information.
+ * 
+ * We provide the Paradyn Tools (below described as "Paradyn")
+ * on an AS IS basis, and do not warrant its validity or performance.
+ * We reserve the right to update, modify, or discontinue this
+ * software at any time.  We shall have no obligation to supply such
+ * updates or modifications or any other form of support to you.
+ * 
+ * By your use of Paradyn, you understand and agree that we (or any
+ * other person or entity with proprietary rights in Paradyn) are
+ * under no obligation to provide either maintenance services,
+ * update services, notices of latent defects, or correction of
+ * defects for Paradyn.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef SIGSAFE_H_
+#define SIGSAFE_H_
+
+#include "basetypes.h"
+
+namespace Dyninst {
+namespace Stackwalker {
+
+//A stackwalker for the current process that can run inside a signal
+// handler, e.g. a SIGPROF sampler.  freeze() snapshots the code and stack
+// mappings and each loaded object's DWARF CFA rules ahead of time; walk()
+// then takes no locks, allocates nothing, and only reads stack slots in a
+// frozen stack mapping whose page is still mapped.  Frames with a frozen
+// rule are unwound through their CFA; the rest fall back to the frame
+// pointer chain.
+class SW_EXPORT SigSafeWalker {
+ public:
+   SigSafeWalker();
+   ~SigSafeWalker();
+
+   //Snapshot the process's mappings and unwind rules.  Not signal-safe;
+   // call again after loading libraries or creating threads.
+   bool freeze();
+
+   //Fill ras with the interrupted pc followed by return addresses, taking
+   // registers from the ucontext_t given to an SA_SIGINFO handler.
+   // Returns the number of entries written.
+   unsigned walk(void *ucontext, Dyninst::Address *ras, unsigned max_frames) const;
+
+   //As walk, starting at the caller of walkHere.
+   unsigned walkHere(Dyninst::Address *ras, unsigned max_frames) const;
+
+ private:
+   struct range_t {
+      Dyninst::Address start;
+      Dyninst::Address end;
+   };
+   //A DWARF row over [start, end): CFA = sp or fp + cfa_offset, the
+   // return address and fp each saved at CFA + offset or unchanged.
+   struct rule_t {
+      Dyninst::Address start;
+      Dyninst::Address end;
+      int cfa_offset;
+      int ra_offset;
+      int fp_offset;
+      unsigned char cfa_reg;
+      unsigned char ra_rule;
+      unsigned char fp_rule;
+   };
+   struct tables_t {
+      range_t *code;
+      unsigned num_code;
+      range_t *stack;
+      unsigned num_stack;
+      rule_t *rules;
+      unsigned num_rules;
+      Dyninst::Address page_size;
+      tables_t *retired;
+   };
+   //Published with an atomic store; superseded tables stay allocated
+   // (chained through retired) since a handler may still be reading them.
+   tables_t *tables;
+
+   static const range_t *findRange(const range_t *ranges, unsigned num, Dyninst::Address addr);
+   static const rule_t *findRule(const rule_t *rules, unsigned num, Dyninst::Address pc);
+   static bool readStack(const tables_t *t, const range_t *stack, Dyninst::Address addr,
+                         Dyninst::Address &mapped_lo, Dyninst::Address &mapped_hi,
+                         Dyninst::Address &val);
+   static unsigned freezeRules(rule_t *&rules);
+
+   unsigned walkFrom(Dyninst::Address pc, Dyninst::Address sp, Dyninst::Address fp,
+                     Dyninst::Address lr, bool pc_is_ra,
+                     Dyninst::Address *ras, unsigned max_frames) const;
+};
+
+}
+}
+
+#endif
@@ -193,6 +193,17 @@ class SW_EXPORT WalkerSet {
    size_t size() const;
 
    bool walkStacks(CallTree &tree, bool walk_initial_only = false) const;
+
+   //Called from walkStacksParallel as each thread's stack is collected
+   typedef void (*progress_cb_t)(unsigned threads_done, unsigned threads_total, void *data);
+
+   //Walk with up to num_workers threads, one stack at a time.  Debugged
+   // processes are stopped for the whole walk.  Stacks are added to tree
+   // in the same order walkStacks adds them.
+   bool walkStacksParallel(CallTree &tree, unsigned num_workers,
+                           bool walk_initial_only = false,
+                           progress_cb_t progress = NULL,
+                           void *progress_data = NULL) const;
 };
 
 }
@@ -37,6 +37,7 @@
 #include "SymReader.h"
 
 #include <string>
+#include <boost/thread/mutex.hpp>
 
 namespace Dyninst {
 namespace ParseAPI {
@@ -75,6 +76,9 @@ class AnalysisStepperImpl : public FrameStepper
    static std::map<std::string, ParseAPI::CodeObject *> objs;
    static std::map<std::string, ParseAPI::CodeSource*> srcs;
    static std::map<std::string, SymReader*> readers;
+   //Guards the maps above and the parsing and analysis of their
+   // CodeObjects, which walkers of different threads share
+   static boost::mutex analysis_lock;
    
    static ParseAPI::CodeObject *getCodeObject(std::string name);
    static ParseAPI::CodeSource *getCodeSource(std::string name);
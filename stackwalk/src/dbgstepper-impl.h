@@ -33,6 +33,8 @@
 
 #include "stackwalk/h/framestepper.h"
 #include "common/h/ProcReader.h"
+#include "common/h/util.h"
+#include <boost/thread/mutex.hpp>
 
 namespace Dyninst {
 
@@ -43,6 +45,10 @@ typedef boost::shared_ptr<DwarfFrameParser> DwarfFrameParserPtr;
 
 namespace Stackwalker {
 
+//The frame parser for a library's DWARF, looking in separate debug
+// files as well; cached per library name.
+Dwarf::DwarfFrameParserPtr getAuxDwarfInfo(std::string s);
+
 class DebugStepperImpl : public FrameStepper, public Dyninst::ProcessReader {
  private:
     struct cache_t {
@@ -56,18 +62,20 @@ class DebugStepperImpl : public FrameStepper, public Dyninst::ProcessReader {
     };
 
     dyn_hash_map<Address, cache_t> cache_;
+    boost::mutex cache_lock;
 
     void addToCache(const Frame &cur, const Frame &caller);
     bool lookupInCache(const Frame &cur, Frame &caller);
 
-   Dyninst::Address last_addr_read;
-   unsigned long last_val_read;
+   //Per thread, as threads of one process may be walked at once
+   static TLS_VAR Dyninst::Address last_addr_read;
+   static TLS_VAR unsigned long last_val_read;
    unsigned addr_width;
       
    location_t getLastComputedLocation(unsigned long val);
    DebugStepper *parent_stepper;
-   const Frame *cur_frame; //TODO: Thread safety
-   const Frame *depth_frame; // Current position in the stackwalk
+   static TLS_VAR const Frame *cur_frame;
+   static TLS_VAR const Frame *depth_frame; // Current position in the stackwalk
  public:
   DebugStepperImpl(Walker *w, DebugStepper *parent);
   virtual gcframe_ret_t getCallerFrame(const Frame &in, Frame &out);
@@ -36,6 +36,7 @@
 #include "stackwalk/h/procstate.h"
 #include "common/src/addrtranslate.h"
 #include <set>
+#include <boost/thread/mutex.hpp>
 
 namespace Dyninst {
 namespace Stackwalker {
@@ -94,6 +95,7 @@ SymbolReaderFactory *getDefaultSymbolReader();
 class LibraryWrapper {
   private:
    std::map<std::string, SymReader *> file_map;
+   boost::mutex file_map_lock;
   public:
    static SymReader *testLibrary(std::string filename);
    static SymReader *getLibrary(std::string filename);
@@ -32,6 +32,8 @@
 #define SW_INTERNAL_H_
 
 #include <set>
+#include <boost/thread/mutex.hpp>
+#include "common/h/util.h"
 #include "common/src/addrRange.h"
 #include "stackwalk/h/framestepper.h"
 #include "stackwalk/h/procstate.h"
@@ -107,6 +109,7 @@ public:
 class DyninstInstrStepperImpl : public FrameStepper {
  private:
    static std::map<SymReader *, bool> isRewritten;
+   static boost::mutex isRewritten_lock;
    DyninstInstrStepper *parent;
 
  public:
@@ -125,7 +128,9 @@ class DyninstDynamicStepperImpl : public FrameStepper {
  private:
    DyninstDynamicStepper *parent;
    DyninstDynamicHelper *helper;
-   bool prevEntryExit; // remember if the previous frame was entry/exit instrumentation
+   // remember if the previous frame was entry/exit instrumentation; per
+   // thread, as threads of one process may be walked at once
+   static TLS_VAR bool prevEntryExit;
   
  public:
    DyninstDynamicStepperImpl(Walker *w, DyninstDynamicStepper *p, DyninstDynamicHelper *h);
@@ -40,6 +40,7 @@
 #include "symtabAPI/h/AddrLookup.h"
 #include "symtabAPI/h/Function.h"
 #include <string>
+#include <boost/thread/mutex.hpp>
 
 using namespace Dyninst::SymtabAPI;
 
@@ -50,6 +51,7 @@ class SymtabWrapper {
  private:
    dyn_hash_map<std::string, Symtab *> map;
    static SymtabWrapper *wrapper;
+   static boost::mutex wrapper_lock;
  protected:
    SymtabWrapper();
  public:
@@ -97,6 +97,11 @@ class SYMTAB_EXPORT typeCollection : public Serializable//, public AnnotatableSp
     // DWARF...
     bool dwarfParsed_;
 
+    // A parallel DWARF parse numbers types provisionally; these give
+    // them their final IDs once every unit is parsed.
+    void renumberTypes(const dyn_hash_map<int, int> &ids);
+    static int nextUserTypeID();
+
 	Serializable *serialize_impl(SerializerBase *, const char * = "typeCollection") THROW_SPEC (SerializerError);
 	public:
     typeCollection();
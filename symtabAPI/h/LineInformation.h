@@ -31,26 +31,27 @@
 #if ! defined( LINE_INFORMATION_H )
 #define LINE_INFORMATION_H
 
+#include <set>
+#include <vector>
 #include "symutil.h"
 #include "RangeLookup.h"
 #include "Serialization.h"
 #include "Annotatable.h"
 #include "Module.h"
+#include <boost/thread/mutex.hpp>
 
 #define NEW_GETSOURCELINES_INTERFACE
 
 namespace Dyninst{
 namespace SymtabAPI{
 
-class SYMTAB_EXPORT LineInformation : 
-                        private RangeLookupTypes< Statement >::type
+class SYMTAB_EXPORT LineInformation
 {
 public:
     typedef RangeLookupTypes< Statement> traits;
-    typedef RangeLookupTypes< Statement >::type impl_t;
-    typedef impl_t::index<Statement::addr_range>::type::const_iterator const_iterator;
-    typedef impl_t::index<Statement::line_info>::type::const_iterator const_line_info_iterator;
-    typedef traits::value_type Statement_t;
+    typedef Statement::Ptr Statement_t;
+    typedef std::vector<Statement_t>::const_iterator const_iterator;
+    typedef std::vector<Statement_t>::const_iterator const_line_info_iterator;
       LineInformation();
 
       /* You MAY freely deallocate the lineSource strings you pass in. */
@@ -73,6 +74,11 @@ public:
             unsigned int lineNo, 
             unsigned int lineOffset = 0 );
 
+      /* Lines added above are staged until freeze() merges them into the
+         sorted tables that the queries below read.  Every query freezes
+         first, so it sees all lines added so far. */
+      void freeze();
+
       /* You MUST NOT deallocate the strings returned. */
       bool getSourceLines(Offset addressInRange, std::vector<Statement_t> &lines);
     bool getSourceLines(Offset addressInRange, std::vector<Statement> &lines);
@@ -99,8 +105,28 @@ public:
     void setStrings(StringTablePtr strings_);
 
 protected:
-    mutable int wasted_compares;
-    mutable int num_queries;
+    // Rows in (start, end) order, as parallel arrays; a row's position is
+    // the same in all four
+    std::vector<Offset> starts_;
+    std::vector<Offset> ends_;
+    // Running maximum of ends; bounds the backwards scan for overlapping
+    // rows
+    std::vector<Offset> max_ends_;
+    std::vector<Statement_t> rows_;
+    // The same rows in (file index, line) order
+    std::vector<Statement_t> by_source_;
+
+    // Rows added since the last freeze, and their (start, end) keys so
+    // duplicates are refused as they are added
+    std::vector<Statement_t> pending_;
+    std::set<std::pair<Offset, Offset> > pending_keys_;
+    // Guards the staged rows and the merge into the tables
+    boost::mutex freeze_lock_;
+
+    bool stage(Statement_t stmt);
+    void freezePending() const;
+    size_t lastRowStartingBefore(Offset addr) const;
+    size_t firstRowContaining(Offset addr) const;
 };
 
 
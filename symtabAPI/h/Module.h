@@ -215,6 +215,15 @@ typedef Statement LineNoTuple;
    bool getStatements(std::vector<Statement::Ptr> &statements);
    LineInformation *getLineInformation();
     LineInformation* parseLineInformation();
+    // Decodes only the line programs of compilation units covering addr;
+    // units with no known address ranges are always decoded.
+    LineInformation* parseLineInformation(Offset addr);
+    // Frees decoded DWARF line information so it is re-decoded on demand.
+    // Statements and the LineInformation previously returned from this
+    // module become invalid. Refused for modules whose line information
+    // can't be rebuilt from DWARF: ones with rows added through
+    // Symtab::addLine/addAddressRange, and ones sharing it with a copy.
+    bool releaseLineInformation();
 
 			bool setDefaultNamespacePrefix(std::string str);
 
@@ -229,7 +238,8 @@ typedef Statement LineNoTuple;
    bool setLineInfo(Dyninst::SymtabAPI::LineInformation *lineInfo);
 	 void addRange(Dyninst::Address low, Dyninst::Address high);
 
-	void addDebugInfo(Module::DebugInfoT info);
+	void addDebugInfo(Module::DebugInfoT info,
+	                  const std::vector<AddressRange> &cu_ranges = std::vector<AddressRange>());
 
 	void finalizeRanges();
 
@@ -237,6 +247,12 @@ typedef Statement LineNoTuple;
    Dyninst::SymtabAPI::LineInformation* lineInfo_;
    typeCollection* typeInfo_;
 	std::vector<Module::DebugInfoT> info_;
+   // Parallel to info_: address ranges of each CU, and whether its line
+   // program has been decoded into lineInfo_
+   std::vector<std::vector<AddressRange> > info_ranges_;
+   std::vector<bool> info_parsed_;
+   // lineInfo_ holds more than its DWARF, or is shared; never release it
+   bool line_info_pinned_;
    
 
    std::string fileName_;                   // short file 
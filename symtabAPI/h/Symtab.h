@@ -32,6 +32,8 @@
 #define __SYMTAB_H__
 
 #include <set>
+#include <list>
+#include <map>
 
 #include "Symbol.h"
 #include "Module.h"
@@ -274,6 +276,21 @@ class SYMTAB_EXPORT Symtab : public LookupInterface,
 
    void parseTypesNow();
 
+   // Number of threads used to parse DWARF types and variables; 1 (the
+   // default) parses serially. Defaults to $DYNINST_DWARF_THREADS.
+   static void setDwarfParseThreads(unsigned n);
+   static unsigned dwarfParseThreads();
+
+   // Maximum number of modules per Symtab whose DWARF line tables are kept
+   // decoded; least recently used ones are released and re-decoded on
+   // demand. 0 (the default) keeps everything. Defaults to
+   // $DYNINST_LINE_CACHE_SIZE. Releasing a module invalidates the
+   // Statement and LineInformation pointers it handed out; callers that
+   // hold on to them must leave the cache unbounded. Modules with lines
+   // added through addLine/addAddressRange are never released.
+   static void setLineInfoCacheSize(unsigned n);
+   static unsigned lineInfoCacheSize();
+
    /***** Local Variable Information *****/
    bool findLocalVariable(std::vector<localVar *>&vars, std::string name);
 
@@ -452,6 +469,8 @@ class SYMTAB_EXPORT Symtab : public LookupInterface,
 
 
    void parseLineInformation();
+   void noteLineInfoUse(Module *mod);
+   void trimLineInfoCache();
    
    void parseTypes();
    bool setDefaultNamespacePrefix(std::string &str);
@@ -601,6 +620,10 @@ class SYMTAB_EXPORT Symtab : public LookupInterface,
    FuncRangeLookup *func_lookup;
     ModRangeLookup *mod_lookup_;
 
+   // Modules with decoded line information, most recently used first
+   std::list<Module *> line_cache_;
+   std::map<Module *, std::list<Module *>::iterator> line_cache_pos_;
+
    //Don't use obj_private, use getObject() instead.
  public:
    Object *getObject();
@@ -33,10 +33,13 @@
 
 #include "symtabAPI/h/Type.h"
 #include "boost/static_assert.hpp"
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/lock_guard.hpp>
 
 namespace Dyninst {
   namespace SymtabAPI {
     extern std::map<void *, size_t> type_memory;
+    extern boost::mutex type_memory_lock;
   }
 }
 
@@ -47,8 +50,12 @@ template<class T>
 T *upgradePlaceholder(Type *placeholder, T *new_type)
 {
   void *mem = (void *) placeholder;
-  assert(type_memory.count(mem));
-  size_t size = type_memory[mem];
+  size_t size;
+  {
+    boost::lock_guard<boost::mutex> g(type_memory_lock);
+    assert(type_memory.count(mem));
+    size = type_memory[mem];
+  }
 
   assert(sizeof(T) < size);
   memset(mem, 0, size);
@@ -12,6 +12,7 @@
 #include <vector>
 #include <string>
 #include <set>
+#include <map>
 #include "dyntypes.h"
 #include "VariableLocation.h"
 #include "Type.h"
@@ -20,6 +21,10 @@
 #include <Collections.h>
 
 namespace Dyninst {
+    namespace Dwarf {
+        class DwarfHandle;
+    }
+
     namespace SymtabAPI {
 
 // A restructuring of walkDwarvenTree
@@ -29,7 +34,9 @@ namespace Dyninst {
         class Object;
         class Function;
         class FunctionBase;
+        class Variable;
         class typeCommon;
+        class typeArray;
         class typeEnum;
         class fieldListType;
         class typeCollection;
@@ -180,8 +187,16 @@ namespace Dyninst {
 
             bool parse();
 
+            // Parses the units with up to nthreads walkers, each over its
+            // own libdwarf session. All units of a module go to the same
+            // walker, so each type collection has a single writer. The
+            // result is the same for any number of threads.
+            bool parseParallel(Dwarf::DwarfHandle *dwarf, unsigned nthreads);
+
             // Takes current debug state as represented by dbg_;
             bool parseModule(Dwarf_Bool is_info, Module *&fixUnknownMod);
+            // Finds the current unit's DIE and sets mod() and the unit's range
+            bool enterModule(Dwarf_Bool is_info, Dwarf_Die &moduleDIE);
 
             // Non-recursive version of parse
             // A Context must be provided as an _input_ to this function,
@@ -195,6 +210,11 @@ namespace Dyninst {
                 InlinedFunc
             };
 
+            // Parses the selected units, or all of them if selected is NULL
+            bool parseUnits(const std::vector<bool> *selected, Module *&fixUnknownMod);
+            bool findUnitModules(std::vector<Module *> &mods);
+            void fixUnknownModTypes(Module *fixUnknownMod);
+
             bool parseSubprogram(inline_t func_type);
             bool parseLexicalBlock();
             bool parseRangeTypes(Dwarf_Debug dbg, Dwarf_Die die);
@@ -314,6 +334,50 @@ namespace Dyninst {
 
             // Header-only functions get multiple parsed.
             std::set<FunctionBase *> parsedFuncs;
+            bool claimFunc(FunctionBase *func);
+            void addFuncName(FunctionBase *func, bool mangled);
+
+            // The unit that describes each function in a parallel parse;
+            // NULL for a serial one
+            const std::map<FunctionBase *, unsigned> *owners_;
+
+            // Index of the unit being parsed, across .debug_types and .debug_info
+            unsigned unit_;
+
+            // Set while a parallel walker only notes the functions its
+            // units describe, in claims_, before the real parse
+            bool claiming_;
+            std::map<FunctionBase *, unsigned> claims_;
+            bool claimEntry();
+
+            // Symtab updates a parallel walker stages, to apply in unit order
+            struct PendingName {
+                unsigned unit;
+                FunctionBase *func;
+                std::string name;
+                bool mangled;
+            };
+            std::vector<PendingName> pendingNames_;
+            struct PendingVarType {
+                unsigned unit;
+                Variable *var;
+                Type *type;
+            };
+            std::vector<PendingVarType> pendingVarTypes_;
+
+            // A parallel walker's type IDs are provisional: the n'th one it
+            // hands out is provisional_base_ + n, and is renumbered in unit
+            // order after the parse. user entries stand in for
+            // Type::USER_TYPE_ID.
+            struct PendingTypeID {
+                unsigned unit;
+                Dwarf_Off offset;
+                bool is_info;
+                bool user;
+            };
+            std::vector<PendingTypeID> pendingTypeIDs_;
+            typeId_t provisional_base_;
+            typeArray *newAnonymousArray(Type *base, long low, long hi, std::string name);
         private:
             std::vector<const char*> srcFiles_;
             char** srcFileList_;